@@ -12,9 +12,12 @@
 #include "Acts/EventData/Measurement.hpp"
 #include "Acts/EventData/TrackStatePropMask.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Utilities/Helpers.hpp"
 #include "Acts/Utilities/TypeTraits.hpp"
 
+#include <algorithm>
+#include <array>
 #include <bitset>
 #include <cstdint>
 #include <memory>
@@ -39,10 +42,27 @@ enum TrackStateFlag {
 
 using TrackStateType = std::bitset<TrackStateFlag::NumTrackStateFlags>;
 
+/// Track state storage keeping full covariance matrices in double precision.
+struct FullTrackStateStorage {};
+
+/// Track state storage keeping only the upper triangle of the symmetric
+/// covariance matrices and calibrated measurements sized to their actual
+/// dimension.
+///
+/// Covariances are reconstructed into regular matrices on access. Writable
+/// accessors write modified entries back into the storage, see
+/// @c detail_lt::PackedMatrixRef.
+///
+/// @tparam scalar_t Scalar type used to store the covariances, e.g. float
+template <typename scalar_t = ActsScalar>
+struct CompactTrackStateStorage {
+  using Scalar = scalar_t;
+};
+
 // forward declarations
-template <typename source_link_t>
+template <typename source_link_t,
+          typename storage_policy_t = FullTrackStateStorage>
 class MultiTrajectory;
-class Surface;
 
 namespace detail_lt {
 /// Either type T or const T depending on the boolean.
@@ -60,8 +80,11 @@ struct GrowableColumns {
   /// @return View into the last allocated column
   auto addCol(size_t n = 1) {
     size_t index = m_size + (n - 1);
-    while (capacity() <= index) {
-      data.conservativeResize(Eigen::NoChange, data.cols() + kSizeIncrement);
+    if (capacity() <= index) {
+      // grow geometrically such that filling an event-level container with
+      // many tracks only reallocates a logarithmic number of times
+      size_t cols = std::max(2 * capacity(), capacity() + kSizeIncrement);
+      data.conservativeResize(Eigen::NoChange, std::max(cols, index + 1));
     }
     m_size = index + 1;
 
@@ -83,6 +106,9 @@ struct GrowableColumns {
 
   size_t size() const { return m_size; }
 
+  /// Remove all columns but keep the allocated storage for reuse.
+  void clear() { m_size = 0; }
+
  private:
   Storage data;
   size_t m_size{0};
@@ -110,10 +136,288 @@ struct Types {
                       SizeIncrement>;
 };
 
+/// Copy of a packed storage element that writes back modifications.
+///
+/// Packed storage can not be mapped by Eigen directly. The stored element
+/// is unpacked into a regular, zero-padded matrix on construction such that
+/// it can be used in any Eigen expression. Assigning a full matrix packs it
+/// immediately. Modifications of single coefficients or blocks are written
+/// back when the accessor goes out of scope.
+///
+/// @tparam matrix_t Fixed-size matrix type to unpack into
+/// @tparam scalar_t Scalar type of the packed storage
+/// @tparam kSymmetric Store only the upper triangle of a square matrix
+/// @tparam ReadOnly true for read-only access to the underlying storage
+///
+/// @note For symmetric storage, an off-diagonal entry is taken from the
+///       element of the upper or lower triangle that was modified. Entries
+///       that were not modified through this accessor are left untouched.
+template <typename matrix_t, typename scalar_t, bool kSymmetric,
+          bool ReadOnly = true>
+class PackedMatrixRef : public matrix_t {
+ public:
+  using Storage = ConstIf<scalar_t, ReadOnly>;
+
+  /// Number of packed scalars needed for the given dimension.
+  static constexpr size_t packedSize(size_t size) {
+    return kSymmetric ? size * (size + 1) / 2 : size;
+  }
+
+  /// @param data Pointer to the packed storage
+  /// @param size Effective dimension, the remaining entries are zero
+  PackedMatrixRef(Storage* data, size_t size) : m_data(data), m_size(size) {
+    unpack();
+  }
+  PackedMatrixRef(const PackedMatrixRef&) = default;
+
+  ~PackedMatrixRef() {
+    if constexpr (not ReadOnly) {
+      writeBack();
+    }
+  }
+
+  PackedMatrixRef& operator=(const PackedMatrixRef& other) {
+    return *this = static_cast<const matrix_t&>(other);
+  }
+
+  template <typename derived_t>
+  PackedMatrixRef& operator=(const Eigen::MatrixBase<derived_t>& other) {
+    static_assert(!ReadOnly, "Can not assign to read-only storage");
+    matrix_t::operator=(other);
+    pack();
+    // reflect the stored precision and symmetry in the local copy
+    unpack();
+    return *this;
+  }
+
+ private:
+  static constexpr size_t kMaxPackedSize =
+      packedSize(matrix_t::RowsAtCompileTime);
+
+  void unpack() {
+    matrix_t::setZero();
+    matrix_t& m = *this;
+    size_t k = 0;
+    for (size_t c = 0; c < m_size; ++c) {
+      if constexpr (kSymmetric) {
+        for (size_t r = 0; r <= c; ++r, ++k) {
+          m(r, c) = m(c, r) = m_data[k];
+        }
+      } else {
+        m(c) = m_data[c];
+      }
+    }
+    if constexpr (not ReadOnly) {
+      std::copy_n(m_data, packedSize(m_size), m_unpacked.begin());
+    }
+  }
+
+  /// Write back the entries modified since the last unpack.
+  void writeBack() const {
+    const matrix_t& m = *this;
+    auto update = [&](size_t k, ActsScalar value) {
+      auto stored = static_cast<scalar_t>(value);
+      if (stored != m_unpacked[k]) {
+        m_data[k] = stored;
+        return true;
+      }
+      return false;
+    };
+    size_t k = 0;
+    for (size_t c = 0; c < m_size; ++c) {
+      if constexpr (kSymmetric) {
+        for (size_t r = 0; r <= c; ++r, ++k) {
+          if (not update(k, m(r, c))) {
+            update(k, m(c, r));
+          }
+        }
+      } else {
+        update(c, m(c));
+      }
+    }
+  }
+
+  void pack() const {
+    const matrix_t& m = *this;
+    size_t k = 0;
+    for (size_t c = 0; c < m_size; ++c) {
+      if constexpr (kSymmetric) {
+        for (size_t r = 0; r <= c; ++r, ++k) {
+          m_data[k] = static_cast<scalar_t>(m(r, c));
+        }
+      } else {
+        m_data[c] = static_cast<scalar_t>(m(c));
+      }
+    }
+  }
+
+  Storage* m_data;
+  size_t m_size;
+  // stored values at the time of the last unpack to detect modifications
+  std::array<std::remove_const_t<scalar_t>, ReadOnly ? 0 : kMaxPackedSize>
+      m_unpacked;
+};
+
+/// Type construction helper for covariances depending on the storage policy.
+template <size_t Size, bool ReadOnly, typename storage_policy_t>
+struct CovarianceTypes {
+  using Covariance = typename Types<Size, ReadOnly>::Covariance;
+  using CovarianceMap = typename Types<Size, ReadOnly>::CovarianceMap;
+  using StorageCovariance = typename Types<Size, ReadOnly>::StorageCovariance;
+
+  template <typename scalar_t>
+  static CovarianceMap map(scalar_t* data, size_t /*size*/) {
+    return CovarianceMap(data);
+  }
+};
+
+template <size_t Size, bool ReadOnly, typename scalar_t>
+struct CovarianceTypes<Size, ReadOnly, CompactTrackStateStorage<scalar_t>> {
+  using Covariance = typename Types<Size, ReadOnly>::Covariance;
+  using CovarianceMap = PackedMatrixRef<Covariance, scalar_t, true, ReadOnly>;
+  using StorageCovariance = GrowableColumns<
+      Eigen::Array<scalar_t, CovarianceMap::packedSize(Size), Eigen::Dynamic,
+                   Eigen::ColMajor | Eigen::AutoAlign>,
+      Types<Size>::SizeIncrement>;
+
+  template <typename data_t>
+  static CovarianceMap map(data_t* data, size_t size) {
+    return CovarianceMap(data, size);
+  }
+};
+
+/// Storage for calibrated measurements depending on the storage policy.
+///
+/// The default storage overallocates every measurement to the maximum
+/// measurement dimension.
+template <size_t M, typename storage_policy_t>
+struct MeasurementStorage {
+  template <bool ReadOnly>
+  using Measurement = typename Types<M, ReadOnly>::CoefficientsMap;
+  template <bool ReadOnly>
+  using MeasurementCovariance = typename Types<M, ReadOnly>::CovarianceMap;
+
+  /// Allocate storage for a new measurement and return its index.
+  size_t add() {
+    parameters.addCol();
+    covariances.addCol();
+    return parameters.size() - 1;
+  }
+
+  /// Ensure the measurement at the given index can hold @p size dimensions.
+  void resize(size_t /*index*/, size_t /*size*/) {}
+
+  void clear() {
+    parameters.clear();
+    covariances.clear();
+  }
+
+  template <bool ReadOnly, typename self_t>
+  static Measurement<ReadOnly> measurement(self_t& self, size_t index,
+                                           size_t /*size*/) {
+    return Measurement<ReadOnly>(self.parameters.col(index).data());
+  }
+
+  template <bool ReadOnly, typename self_t>
+  static MeasurementCovariance<ReadOnly> covariance(self_t& self, size_t index,
+                                                    size_t /*size*/) {
+    return MeasurementCovariance<ReadOnly>(self.covariances.col(index).data());
+  }
+
+  typename Types<M>::StorageCoefficients parameters;
+  typename Types<M>::StorageCovariance covariances;
+};
+
+/// Compact measurement storage that only keeps the actual dimensions and the
+/// upper triangle of the covariance in flat, shared buffers.
+template <size_t M, typename scalar_t>
+struct MeasurementStorage<M, CompactTrackStateStorage<scalar_t>> {
+  template <bool ReadOnly>
+  using Measurement = PackedMatrixRef<typename Types<M>::Coefficients,
+                                      ActsScalar, false, ReadOnly>;
+  template <bool ReadOnly>
+  using MeasurementCovariance =
+      PackedMatrixRef<typename Types<M>::Covariance, scalar_t, true, ReadOnly>;
+
+  struct Entry {
+    size_t iparameters = 0;
+    size_t icovariance = 0;
+    size_t size = 0;
+    size_t capacity = 0;
+  };
+
+  size_t add() {
+    entries.emplace_back();
+    return entries.size() - 1;
+  }
+
+  void resize(size_t index, size_t size) {
+    Entry& entry = entries[index];
+    if (entry.size == size) {
+      return;
+    }
+    if (entry.capacity < size) {
+      // hand the previous storage to the next measurement of the same size
+      if (entry.capacity != 0) {
+        released[entry.capacity].push_back(entry);
+      }
+      auto& pool = released[size];
+      if (pool.empty()) {
+        entry.iparameters = parameters.size();
+        entry.icovariance = covariances.size();
+        parameters.resize(parameters.size() + size);
+        covariances.resize(covariances.size() +
+                           MeasurementCovariance<true>::packedSize(size));
+      } else {
+        entry.iparameters = pool.back().iparameters;
+        entry.icovariance = pool.back().icovariance;
+        pool.pop_back();
+      }
+      entry.capacity = size;
+    }
+    entry.size = size;
+    // a resized measurement always starts out empty
+    std::fill_n(parameters.begin() + entry.iparameters, size, 0);
+    std::fill_n(covariances.begin() + entry.icovariance,
+                MeasurementCovariance<true>::packedSize(size), 0);
+  }
+
+  void clear() {
+    entries.clear();
+    parameters.clear();
+    covariances.clear();
+    for (auto& pool : released) {
+      pool.clear();
+    }
+  }
+
+  template <bool ReadOnly, typename self_t>
+  static Measurement<ReadOnly> measurement(self_t& self, size_t index,
+                                           size_t size) {
+    const Entry& entry = self.entries[index];
+    assert(size <= entry.size);
+    return {self.parameters.data() + entry.iparameters, size};
+  }
+
+  template <bool ReadOnly, typename self_t>
+  static MeasurementCovariance<ReadOnly> covariance(self_t& self, size_t index,
+                                                    size_t size) {
+    const Entry& entry = self.entries[index];
+    assert(size <= entry.size);
+    return {self.covariances.data() + entry.icovariance, size};
+  }
+
+  std::vector<Entry> entries;
+  std::vector<ActsScalar> parameters;
+  std::vector<scalar_t> covariances;
+  // unused storage blocks by capacity
+  std::array<std::vector<Entry>, M + 1> released;
+};
+
 struct IndexData {
-  using IndexType = uint16_t;
+  using IndexType = uint32_t;
 
-  static constexpr IndexType kInvalid = UINT16_MAX;
+  static constexpr IndexType kInvalid = UINT32_MAX;
 
   IndexType irefsurface = kInvalid;
   IndexType iprevious = kInvalid;
@@ -138,14 +442,21 @@ struct IndexData {
 /// @tparam source_link_t Type to link back to an original measurement
 /// @tparam M         Maximum number of measurement dimensions
 /// @tparam ReadOnly  true for read-only access to underlying storage
-template <typename source_link_t, size_t M, bool ReadOnly = true>
+/// @tparam storage_policy_t Storage policy of the parent trajectory
+template <typename source_link_t, size_t M, bool ReadOnly = true,
+          typename storage_policy_t = FullTrackStateStorage>
 class TrackStateProxy {
  public:
   using SourceLink = source_link_t;
+  using Trajectory = MultiTrajectory<SourceLink, storage_policy_t>;
   using Parameters = typename Types<eBoundSize, ReadOnly>::CoefficientsMap;
-  using Covariance = typename Types<eBoundSize, ReadOnly>::CovarianceMap;
-  using Measurement = typename Types<M, ReadOnly>::CoefficientsMap;
-  using MeasurementCovariance = typename Types<M, ReadOnly>::CovarianceMap;
+  using Covariance = typename CovarianceTypes<eBoundSize, ReadOnly,
+                                              storage_policy_t>::CovarianceMap;
+  using Jacobian = typename Types<eBoundSize, ReadOnly>::CovarianceMap;
+  using Measurement = typename MeasurementStorage<
+      M, storage_policy_t>::template Measurement<ReadOnly>;
+  using MeasurementCovariance = typename MeasurementStorage<
+      M, storage_policy_t>::template MeasurementCovariance<ReadOnly>;
 
   // as opposed to the types above, this is an actual Matrix (rather than a
   // map)
@@ -186,9 +497,11 @@ class TrackStateProxy {
   ///       with the source track state proxy, an exception is thrown.
   /// @note The mask parameter will not cause a copy of components that are
   ///       not allocated in the source track state proxy.
+  /// @note The other track state can use a different storage policy.
   template <bool RO = ReadOnly, bool ReadOnlyOther,
-            typename = std::enable_if<!RO>>
-  void copyFrom(const TrackStateProxy<source_link_t, M, ReadOnlyOther>& other,
+            typename storage_policy_other_t, typename = std::enable_if<!RO>>
+  void copyFrom(const TrackStateProxy<source_link_t, M, ReadOnlyOther,
+                                      storage_policy_other_t>& other,
                 TrackStatePropMask mask = TrackStatePropMask::All) {
     using PM = TrackStatePropMask;
     auto dest = getMask();
@@ -226,9 +539,9 @@ class TrackStateProxy {
 
     if (ACTS_CHECK_BIT(src, PM::Calibrated)) {
       calibratedSourceLink() = other.calibratedSourceLink();
+      setCalibratedSize(other.data().measdim);
       calibrated() = other.calibrated();
       calibratedCovariance() = other.calibratedCovariance();
-      data().measdim = other.data().measdim;
       setProjectorBitset(other.projectorBitset());
     }
 
@@ -237,7 +550,8 @@ class TrackStateProxy {
     typeFlags() = other.typeFlags();
 
     // can be nullptr, but we just take that
-    setReferenceSurface(other.referenceSurfacePointer());
+    m_traj->setReferenceSurface(data().irefsurface,
+                                other.referenceSurfacePointer());
   }
 
   /// Return the index tuple that makes up this track state
@@ -254,9 +568,23 @@ class TrackStateProxy {
   /// Set the reference surface to a given value
   /// @param srf Shared pointer to the surface to set
   /// @note This overload is only present in case @c ReadOnly is false.
+  /// @note Only free surfaces, i.e. without an associated detector element,
+  ///       are kept alive by the trajectory.
   template <bool RO = ReadOnly, typename = std::enable_if_t<!RO>>
   void setReferenceSurface(std::shared_ptr<const Surface> srf) {
-    m_traj->m_referenceSurfaces[data().irefsurface] = std::move(srf);
+    const Surface* surface = srf.get();
+    m_traj->setReferenceSurface(data().irefsurface, surface, std::move(srf));
+  }
+
+  /// Set the reference surface to a given value
+  /// @param srf The surface to set
+  /// @note This overload is only present in case @c ReadOnly is false.
+  /// @note Surfaces of detector elements are referenced without touching
+  ///       their reference count and must outlive the trajectory. Free
+  ///       surfaces must be managed by a shared pointer.
+  template <bool RO = ReadOnly, typename = std::enable_if_t<!RO>>
+  void setReferenceSurface(const Surface& srf) {
+    m_traj->setReferenceSurface(data().irefsurface, &srf);
   }
 
   /// Track parameters vector. This tries to be somewhat smart and return the
@@ -310,7 +638,7 @@ class TrackStateProxy {
 
   /// Returns the jacobian from the previous trackstate to this one
   /// @return The jacobian matrix
-  Covariance jacobian() const;
+  Jacobian jacobian() const;
 
   /// Returns whether a jacobian is set for this trackstate
   /// @return Whether it is set
@@ -422,17 +750,32 @@ class TrackStateProxy {
   MeasurementCovariance calibratedCovariance() const;
 
   /// Dynamic measurement vector with only the valid dimensions.
+  /// @note With compact storage this is a read-only copy.
   /// @return The effective calibrated measurement vector
-  auto effectiveCalibrated() const { return calibrated().head(data().measdim); }
+  auto effectiveCalibrated() const {
+    if constexpr (std::is_same_v<storage_policy_t, FullTrackStateStorage>) {
+      return calibrated().head(data().measdim);
+    } else {
+      return calibrated().head(data().measdim).eval();
+    }
+  }
 
   /// Dynamic measurement covariance matrix with only the valid dimensions.
+  /// @note With compact storage this is a read-only copy.
   /// @return The effective calibrated covariance matrix
   auto effectiveCalibratedCovariance() const {
-    return calibratedCovariance().topLeftCorner(data().measdim, data().measdim);
+    if constexpr (std::is_same_v<storage_policy_t, FullTrackStateStorage>) {
+      return calibratedCovariance().topLeftCorner(data().measdim,
+                                                  data().measdim);
+    } else {
+      return calibratedCovariance()
+          .topLeftCorner(data().measdim, data().measdim)
+          .eval();
+    }
   }
 
   /// Return the (dynamic) number of dimensions stored for this measurement.
-  /// @note The underlying storage is overallocated to MeasurementSizeMax
+  /// @note The default storage is overallocated to MeasurementSizeMax
   /// regardless of this value
   /// @return The number of dimensions
   size_t calibratedSize() const { return data().measdim; }
@@ -454,19 +797,20 @@ class TrackStateProxy {
     static_assert(kMeasurementSize <= M,
                   "Input measurement must be within the allowed size");
 
-    IndexData& dataref = data();
-    dataref.measdim = kMeasurementSize;
-
-    assert(dataref.icalibratedsourcelink != IndexData::kInvalid);
+    assert(data().icalibratedsourcelink != IndexData::kInvalid);
     calibratedSourceLink() = meas.sourceLink();
 
     assert(hasCalibrated());
-    calibrated().setZero();
-    calibrated().template head<kMeasurementSize>() = meas.parameters();
-    calibratedCovariance().setZero();
-    calibratedCovariance()
-        .template topLeftCorner<kMeasurementSize, kMeasurementSize>() =
+    setCalibratedSize(kMeasurementSize);
+    // assign full, zero-padded objects such that compact storage is updated
+    typename Types<M>::Coefficients parameters =
+        Types<M>::Coefficients::Zero();
+    parameters.template head<kMeasurementSize>() = meas.parameters();
+    calibrated() = parameters;
+    typename Types<M>::Covariance covariance = Types<M>::Covariance::Zero();
+    covariance.template topLeftCorner<kMeasurementSize, kMeasurementSize>() =
         meas.covariance();
+    calibratedCovariance() = covariance;
     setProjector(meas.projector());
   }
 
@@ -493,10 +837,8 @@ class TrackStateProxy {
     dataref.icalibratedsourcelink = traj.m_sourceLinks.size() - 1;
 
     // force reallocate, whether currently invalid or shared index
-    traj.m_meas.addCol();
-    traj.m_measCov.addCol();
     // shared index between meas par and cov
-    dataref.icalibrated = traj.m_meas.size() - 1;
+    dataref.icalibrated = traj.m_measurements.add();
 
     traj.m_projectors.emplace_back();
     dataref.iprojector = traj.m_projectors.size() - 1;
@@ -549,31 +891,40 @@ class TrackStateProxy {
 
  private:
   // Private since it can only be created by the trajectory.
-  TrackStateProxy(ConstIf<MultiTrajectory<SourceLink>, ReadOnly>& trajectory,
+  TrackStateProxy(ConstIf<Trajectory, ReadOnly>& trajectory,
                   size_t istate);
 
-  const std::shared_ptr<const Surface>& referenceSurfacePointer() const {
+  const Surface* referenceSurfacePointer() const {
     assert(data().irefsurface != IndexData::kInvalid);
     return m_traj->m_referenceSurfaces[data().irefsurface];
   }
 
-  typename MultiTrajectory<SourceLink>::ProjectorBitset projectorBitset()
-      const {
+  typename Trajectory::ProjectorBitset projectorBitset() const {
     assert(data().iprojector != IndexData::kInvalid);
     return m_traj->m_projectors[data().iprojector];
   }
 
   template <bool RO = ReadOnly, typename = std::enable_if_t<!RO>>
-  void setProjectorBitset(
-      typename MultiTrajectory<SourceLink>::ProjectorBitset proj) {
+  void setProjectorBitset(typename Trajectory::ProjectorBitset proj) {
     assert(data().iprojector != IndexData::kInvalid);
     m_traj->m_projectors[data().iprojector] = proj;
   }
 
-  ConstIf<MultiTrajectory<SourceLink>, ReadOnly>* m_traj;
+  /// Set the number of calibrated dimensions and make sure the storage of
+  /// the calibrated measurement is large enough.
+  template <bool RO = ReadOnly, typename = std::enable_if_t<!RO>>
+  void setCalibratedSize(size_t size) {
+    assert(data().icalibrated != IndexData::kInvalid);
+    data().measdim = size;
+    m_traj->m_measurements.resize(data().icalibrated, size);
+  }
+
+  ConstIf<Trajectory, ReadOnly>* m_traj;
   size_t m_istate;
 
-  friend class Acts::MultiTrajectory<SourceLink>;
+  friend class Acts::MultiTrajectory<SourceLink, storage_policy_t>;
+  template <typename, size_t, bool, typename>
+  friend class TrackStateProxy;
 };
 
 // implement track state visitor concept
@@ -596,17 +947,22 @@ constexpr bool VisitorConcept = Concepts ::require<
 /// can be easily identified. Some functionality is provided to simplify
 /// iterating over specific sub-components.
 /// @tparam source_link_t Type to link back to an original measurement
-template <typename source_link_t>
+/// @tparam storage_policy_t How covariances and measurements are stored,
+///   either @c FullTrackStateStorage or @c CompactTrackStateStorage
+template <typename source_link_t, typename storage_policy_t>
 class MultiTrajectory {
  public:
   enum {
     MeasurementSizeMax = eBoundSize,
   };
   using SourceLink = source_link_t;
+  using StoragePolicy = storage_policy_t;
   using ConstTrackStateProxy =
-      detail_lt::TrackStateProxy<SourceLink, MeasurementSizeMax, true>;
+      detail_lt::TrackStateProxy<SourceLink, MeasurementSizeMax, true,
+                                 StoragePolicy>;
   using TrackStateProxy =
-      detail_lt::TrackStateProxy<SourceLink, MeasurementSizeMax, false>;
+      detail_lt::TrackStateProxy<SourceLink, MeasurementSizeMax, false,
+                                 StoragePolicy>;
   using ProjectorBitset = std::bitset<eBoundSize * MeasurementSizeMax>;
 
   /// Create an empty trajectory.
@@ -650,26 +1006,45 @@ class MultiTrajectory {
   template <typename F>
   void applyBackwards(size_t iendpoint, F&& callable);
 
+  /// Number of track states stored in the trajectory.
+  size_t size() const { return m_index.size(); }
+
+  /// Remove all track states but keep the allocated storage.
+  ///
+  /// This allows reusing a single trajectory, e.g. one holding all tracks of
+  /// an event, without reallocating its columns for every event. All
+  /// previously returned indices and proxies are invalidated.
+  void clear();
+
  private:
+  /// Store a non-owning reference surface and retain free surfaces.
+  /// @param isurface index of the reference surface slot
+  /// @param srf the surface to reference, can be nullptr
+  /// @param owner optional shared pointer that already owns @p srf
+  void setReferenceSurface(size_t isurface, const Surface* srf,
+                           std::shared_ptr<const Surface> owner = nullptr);
+
   /// index to map track states to the corresponding
   std::vector<detail_lt::IndexData> m_index;
   typename detail_lt::Types<eBoundSize>::StorageCoefficients m_params;
-  typename detail_lt::Types<eBoundSize>::StorageCovariance m_cov;
-  typename detail_lt::Types<MeasurementSizeMax>::StorageCoefficients m_meas;
-  typename detail_lt::Types<MeasurementSizeMax>::StorageCovariance m_measCov;
+  typename detail_lt::CovarianceTypes<eBoundSize, true,
+                                      StoragePolicy>::StorageCovariance m_cov;
+  detail_lt::MeasurementStorage<MeasurementSizeMax, StoragePolicy>
+      m_measurements;
   typename detail_lt::Types<eBoundSize>::StorageCovariance m_jac;
   std::vector<SourceLink> m_sourceLinks;
   std::vector<ProjectorBitset> m_projectors;
 
-  // owning vector of shared pointers to surfaces
-  // @TODO: This might be problematic when appending a large number of surfaces
-  // trackstates, because vector has to reallocated and thus copy. This might
-  // be handled in a smart way by moving but not sure.
-  std::vector<std::shared_ptr<const Surface>> m_referenceSurfaces;
+  // non-owning pointers to the reference surfaces of the track states.
+  // surfaces bound to a detector element are owned by the geometry and are
+  // not reference counted for every state.
+  std::vector<const Surface*> m_referenceSurfaces;
+  // keeps free surfaces, e.g. perigee or curvilinear ones, alive. one entry
+  // per reference surface slot, empty for surfaces owned by the geometry.
+  std::vector<std::shared_ptr<const Surface>> m_freeSurfaces;
 
-  friend class detail_lt::TrackStateProxy<SourceLink, MeasurementSizeMax, true>;
-  friend class detail_lt::TrackStateProxy<SourceLink, MeasurementSizeMax,
-                                          false>;
+  friend ConstTrackStateProxy;
+  friend TrackStateProxy;
 };
 
 }  // namespace Acts
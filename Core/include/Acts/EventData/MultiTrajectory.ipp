@@ -18,13 +18,13 @@
 
 namespace Acts {
 namespace detail_lt {
-template <typename SL, size_t M, bool ReadOnly>
-inline TrackStateProxy<SL, M, ReadOnly>::TrackStateProxy(
-    ConstIf<MultiTrajectory<SL>, ReadOnly>& trajectory, size_t istate)
+template <typename SL, size_t M, bool ReadOnly, typename SP>
+inline TrackStateProxy<SL, M, ReadOnly, SP>::TrackStateProxy(
+    ConstIf<MultiTrajectory<SL, SP>, ReadOnly>& trajectory, size_t istate)
     : m_traj(&trajectory), m_istate(istate) {}
 
-template <typename SL, size_t M, bool ReadOnly>
-TrackStatePropMask TrackStateProxy<SL, M, ReadOnly>::getMask() const {
+template <typename SL, size_t M, bool ReadOnly, typename SP>
+TrackStatePropMask TrackStateProxy<SL, M, ReadOnly, SP>::getMask() const {
   using PM = TrackStatePropMask;
 
   PM mask = PM::None;
@@ -49,8 +49,9 @@ TrackStatePropMask TrackStateProxy<SL, M, ReadOnly>::getMask() const {
   return mask;
 }
 
-template <typename SL, size_t M, bool ReadOnly>
-inline auto TrackStateProxy<SL, M, ReadOnly>::parameters() const -> Parameters {
+template <typename SL, size_t M, bool ReadOnly, typename SP>
+inline auto TrackStateProxy<SL, M, ReadOnly, SP>::parameters() const
+    -> Parameters {
   IndexData::IndexType idx;
   if (hasSmoothed()) {
     idx = data().ismoothed;
@@ -60,11 +61,12 @@ inline auto TrackStateProxy<SL, M, ReadOnly>::parameters() const -> Parameters {
     idx = data().ipredicted;
   }
 
-  return Parameters(m_traj->m_params.data.col(idx).data());
+  return Parameters(m_traj->m_params.col(idx).data());
 }
 
-template <typename SL, size_t M, bool ReadOnly>
-inline auto TrackStateProxy<SL, M, ReadOnly>::covariance() const -> Covariance {
+template <typename SL, size_t M, bool ReadOnly, typename SP>
+inline auto TrackStateProxy<SL, M, ReadOnly, SP>::covariance() const
+    -> Covariance {
   IndexData::IndexType idx;
   if (hasSmoothed()) {
     idx = data().ismoothed;
@@ -73,94 +75,106 @@ inline auto TrackStateProxy<SL, M, ReadOnly>::covariance() const -> Covariance {
   } else {
     idx = data().ipredicted;
   }
-  return Covariance(m_traj->m_cov.data.col(idx).data());
+  return CovarianceTypes<eBoundSize, ReadOnly, SP>::map(
+      m_traj->m_cov.col(idx).data(), eBoundSize);
 }
 
-template <typename SL, size_t M, bool ReadOnly>
-inline auto TrackStateProxy<SL, M, ReadOnly>::predicted() const -> Parameters {
+template <typename SL, size_t M, bool ReadOnly, typename SP>
+inline auto TrackStateProxy<SL, M, ReadOnly, SP>::predicted() const
+    -> Parameters {
   assert(data().ipredicted != IndexData::kInvalid);
   return Parameters(m_traj->m_params.col(data().ipredicted).data());
 }
 
-template <typename SL, size_t M, bool ReadOnly>
-inline auto TrackStateProxy<SL, M, ReadOnly>::predictedCovariance() const
+template <typename SL, size_t M, bool ReadOnly, typename SP>
+inline auto TrackStateProxy<SL, M, ReadOnly, SP>::predictedCovariance() const
     -> Covariance {
   assert(data().ipredicted != IndexData::kInvalid);
-  return Covariance(m_traj->m_cov.col(data().ipredicted).data());
+  return CovarianceTypes<eBoundSize, ReadOnly, SP>::map(
+      m_traj->m_cov.col(data().ipredicted).data(), eBoundSize);
 }
 
-template <typename SL, size_t M, bool ReadOnly>
-inline auto TrackStateProxy<SL, M, ReadOnly>::filtered() const -> Parameters {
+template <typename SL, size_t M, bool ReadOnly, typename SP>
+inline auto TrackStateProxy<SL, M, ReadOnly, SP>::filtered() const
+    -> Parameters {
   assert(data().ifiltered != IndexData::kInvalid);
   return Parameters(m_traj->m_params.col(data().ifiltered).data());
 }
 
-template <typename SL, size_t M, bool ReadOnly>
-inline auto TrackStateProxy<SL, M, ReadOnly>::filteredCovariance() const
+template <typename SL, size_t M, bool ReadOnly, typename SP>
+inline auto TrackStateProxy<SL, M, ReadOnly, SP>::filteredCovariance() const
     -> Covariance {
   assert(data().ifiltered != IndexData::kInvalid);
-  return Covariance(m_traj->m_cov.col(data().ifiltered).data());
+  return CovarianceTypes<eBoundSize, ReadOnly, SP>::map(
+      m_traj->m_cov.col(data().ifiltered).data(), eBoundSize);
 }
 
-template <typename SL, size_t M, bool ReadOnly>
-inline auto TrackStateProxy<SL, M, ReadOnly>::smoothed() const -> Parameters {
+template <typename SL, size_t M, bool ReadOnly, typename SP>
+inline auto TrackStateProxy<SL, M, ReadOnly, SP>::smoothed() const
+    -> Parameters {
   assert(data().ismoothed != IndexData::kInvalid);
   return Parameters(m_traj->m_params.col(data().ismoothed).data());
 }
 
-template <typename SL, size_t M, bool ReadOnly>
-inline auto TrackStateProxy<SL, M, ReadOnly>::smoothedCovariance() const
+template <typename SL, size_t M, bool ReadOnly, typename SP>
+inline auto TrackStateProxy<SL, M, ReadOnly, SP>::smoothedCovariance() const
     -> Covariance {
   assert(data().ismoothed != IndexData::kInvalid);
-  return Covariance(m_traj->m_cov.col(data().ismoothed).data());
+  return CovarianceTypes<eBoundSize, ReadOnly, SP>::map(
+      m_traj->m_cov.col(data().ismoothed).data(), eBoundSize);
 }
 
-template <typename SL, size_t M, bool ReadOnly>
-inline auto TrackStateProxy<SL, M, ReadOnly>::jacobian() const -> Covariance {
+template <typename SL, size_t M, bool ReadOnly, typename SP>
+inline auto TrackStateProxy<SL, M, ReadOnly, SP>::jacobian() const
+    -> Jacobian {
   assert(data().ijacobian != IndexData::kInvalid);
-  return Covariance(m_traj->m_jac.col(data().ijacobian).data());
+  return Jacobian(m_traj->m_jac.col(data().ijacobian).data());
 }
 
-template <typename SL, size_t M, bool ReadOnly>
-inline auto TrackStateProxy<SL, M, ReadOnly>::projector() const -> Projector {
+template <typename SL, size_t M, bool ReadOnly, typename SP>
+inline auto TrackStateProxy<SL, M, ReadOnly, SP>::projector() const
+    -> Projector {
   assert(data().iprojector != IndexData::kInvalid);
   return bitsetToMatrix<Projector>(m_traj->m_projectors[data().iprojector]);
 }
 
-template <typename SL, size_t M, bool ReadOnly>
-inline auto TrackStateProxy<SL, M, ReadOnly>::uncalibrated() const
+template <typename SL, size_t M, bool ReadOnly, typename SP>
+inline auto TrackStateProxy<SL, M, ReadOnly, SP>::uncalibrated() const
     -> const SourceLink& {
   assert(data().iuncalibrated != IndexData::kInvalid);
   return m_traj->m_sourceLinks[data().iuncalibrated];
 }
 
-template <typename SL, size_t M, bool ReadOnly>
-inline auto TrackStateProxy<SL, M, ReadOnly>::calibrated() const
+template <typename SL, size_t M, bool ReadOnly, typename SP>
+inline auto TrackStateProxy<SL, M, ReadOnly, SP>::calibrated() const
     -> Measurement {
   assert(data().icalibrated != IndexData::kInvalid);
-  return Measurement(m_traj->m_meas.col(data().icalibrated).data());
+  using Storage = MeasurementStorage<M, SP>;
+  return Storage::template measurement<ReadOnly>(
+      m_traj->m_measurements, data().icalibrated, data().measdim);
 }
 
-template <typename SL, size_t M, bool ReadOnly>
-inline auto TrackStateProxy<SL, M, ReadOnly>::calibratedSourceLink() const
+template <typename SL, size_t M, bool ReadOnly, typename SP>
+inline auto TrackStateProxy<SL, M, ReadOnly, SP>::calibratedSourceLink() const
     -> const SourceLink& {
   assert(data().icalibratedsourcelink != IndexData::kInvalid);
   return m_traj->m_sourceLinks[data().icalibratedsourcelink];
 }
 
-template <typename SL, size_t M, bool ReadOnly>
-inline auto TrackStateProxy<SL, M, ReadOnly>::calibratedCovariance() const
+template <typename SL, size_t M, bool ReadOnly, typename SP>
+inline auto TrackStateProxy<SL, M, ReadOnly, SP>::calibratedCovariance() const
     -> MeasurementCovariance {
   assert(data().icalibrated != IndexData::kInvalid);
-  return MeasurementCovariance(
-      m_traj->m_measCov.col(data().icalibrated).data());
+  using Storage = MeasurementStorage<M, SP>;
+  return Storage::template covariance<ReadOnly>(
+      m_traj->m_measurements, data().icalibrated, data().measdim);
 }
 
 }  // namespace detail_lt
 
-template <typename SL>
-inline size_t MultiTrajectory<SL>::addTrackState(TrackStatePropMask mask,
-                                                 size_t iprevious) {
+template <typename SL, typename SP>
+inline size_t MultiTrajectory<SL, SP>::addTrackState(TrackStatePropMask mask,
+                                                     size_t iprevious) {
   using PropMask = TrackStatePropMask;
 
   m_index.emplace_back();
@@ -168,11 +182,12 @@ inline size_t MultiTrajectory<SL>::addTrackState(TrackStatePropMask mask,
   size_t index = m_index.size() - 1;
 
   if (iprevious != SIZE_MAX) {
-    p.iprevious = static_cast<uint16_t>(iprevious);
+    p.iprevious = static_cast<detail_lt::IndexData::IndexType>(iprevious);
   }
 
   // always set, but can be null
   m_referenceSurfaces.emplace_back(nullptr);
+  m_freeSurfaces.emplace_back(nullptr);
   p.irefsurface = m_referenceSurfaces.size() - 1;
 
   if (ACTS_CHECK_BIT(mask, PropMask::Predicted)) {
@@ -204,9 +219,7 @@ inline size_t MultiTrajectory<SL>::addTrackState(TrackStatePropMask mask,
   }
 
   if (ACTS_CHECK_BIT(mask, PropMask::Calibrated)) {
-    m_meas.addCol();
-    m_measCov.addCol();
-    p.icalibrated = m_meas.size() - 1;
+    p.icalibrated = m_measurements.add();
 
     m_sourceLinks.emplace_back();
     p.icalibratedsourcelink = m_sourceLinks.size() - 1;
@@ -218,9 +231,35 @@ inline size_t MultiTrajectory<SL>::addTrackState(TrackStatePropMask mask,
   return index;
 }
 
-template <typename SL>
+template <typename SL, typename SP>
+inline void MultiTrajectory<SL, SP>::clear() {
+  m_index.clear();
+  m_params.clear();
+  m_cov.clear();
+  m_measurements.clear();
+  m_jac.clear();
+  m_sourceLinks.clear();
+  m_projectors.clear();
+  m_referenceSurfaces.clear();
+  m_freeSurfaces.clear();
+}
+
+template <typename SL, typename SP>
+inline void MultiTrajectory<SL, SP>::setReferenceSurface(
+    size_t isurface, const Surface* srf, std::shared_ptr<const Surface> owner) {
+  m_referenceSurfaces[isurface] = srf;
+  // replaces, and possibly releases, the surface previously held by the slot
+  if (srf != nullptr && srf->associatedDetectorElement() == nullptr) {
+    m_freeSurfaces[isurface] = owner ? std::move(owner) : srf->getSharedPtr();
+  } else {
+    m_freeSurfaces[isurface].reset();
+  }
+}
+
+template <typename SL, typename SP>
 template <typename F>
-void MultiTrajectory<SL>::visitBackwards(size_t iendpoint, F&& callable) const {
+void MultiTrajectory<SL, SP>::visitBackwards(size_t iendpoint,
+                                             F&& callable) const {
   static_assert(detail_lt::VisitorConcept<F, ConstTrackStateProxy>,
                 "Callable needs to satisfy VisitorConcept");
 
@@ -245,9 +284,9 @@ void MultiTrajectory<SL>::visitBackwards(size_t iendpoint, F&& callable) const {
   }
 }
 
-template <typename SL>
+template <typename SL, typename SP>
 template <typename F>
-void MultiTrajectory<SL>::applyBackwards(size_t iendpoint, F&& callable) {
+void MultiTrajectory<SL, SP>::applyBackwards(size_t iendpoint, F&& callable) {
   static_assert(detail_lt::VisitorConcept<F, TrackStateProxy>,
                 "Callable needs to satisfy VisitorConcept");
 
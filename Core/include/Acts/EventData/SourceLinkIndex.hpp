@@ -0,0 +1,143 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/EventData/SourceLinkConcept.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+namespace Acts {
+
+/// Flat index of source links grouped by surface.
+///
+/// The source links are stored in a single contiguous container sorted by
+/// their geometry identifier. The relative order of source links on the same
+/// surface is preserved. A second, much smaller, container stores the
+/// distinct geometry identifiers together with the offset of their first
+/// source link, i.e. all source links on a surface are found with a binary
+/// search over the surfaces followed by a contiguous range.
+///
+/// Input that is already sorted, e.g. a `GeometryIdMultiset` as used in the
+/// examples, is copied without sorting. The index can be cleared and
+/// re-assigned to reuse its storage.
+///
+/// @tparam source_link_t Source link type fulfilling the SourceLinkConcept
+template <typename source_link_t>
+class SourceLinkIndex {
+  static_assert(SourceLinkConcept<source_link_t>,
+                "Source link does not fulfill SourceLinkConcept");
+
+ public:
+  using value_type = source_link_t;
+  using const_iterator = typename std::vector<source_link_t>::const_iterator;
+
+  /// Contiguous range of source links on a single surface.
+  class Range {
+   public:
+    Range() = default;
+    Range(const source_link_t* begin, const source_link_t* end)
+        : m_begin(begin), m_end(end) {}
+
+    const source_link_t* begin() const { return m_begin; }
+    const source_link_t* end() const { return m_end; }
+    bool empty() const { return m_begin == m_end; }
+    size_t size() const { return m_end - m_begin; }
+    const source_link_t& operator[](size_t i) const { return m_begin[i]; }
+    const source_link_t& front() const { return *m_begin; }
+
+   private:
+    const source_link_t* m_begin = nullptr;
+    const source_link_t* m_end = nullptr;
+  };
+
+  SourceLinkIndex() = default;
+  /// Construct from any container of source links.
+  ///
+  /// @param sourceLinks Input source links in arbitrary order
+  template <typename source_link_container_t>
+  explicit SourceLinkIndex(const source_link_container_t& sourceLinks) {
+    assign(sourceLinks.begin(), sourceLinks.end());
+  }
+
+  /// Replace the content with the given source links.
+  ///
+  /// @param begin Iterator to the first input source link
+  /// @param end Iterator past the last input source link
+  template <typename input_iterator_t>
+  void assign(input_iterator_t begin, input_iterator_t end) {
+    auto compare = [](const source_link_t& lhs, const source_link_t& rhs) {
+      return lhs.geometryId() < rhs.geometryId();
+    };
+
+    m_sourceLinks.assign(begin, end);
+    if (not std::is_sorted(m_sourceLinks.begin(), m_sourceLinks.end(),
+                           compare)) {
+      std::stable_sort(m_sourceLinks.begin(), m_sourceLinks.end(), compare);
+    }
+
+    m_geometryIds.clear();
+    m_offsets.clear();
+    for (size_t i = 0; i < m_sourceLinks.size(); ++i) {
+      const GeometryIdentifier geoId = m_sourceLinks[i].geometryId();
+      if (m_geometryIds.empty() or m_geometryIds.back() != geoId) {
+        m_geometryIds.push_back(geoId);
+        m_offsets.push_back(i);
+      }
+    }
+    m_offsets.push_back(m_sourceLinks.size());
+  }
+
+  /// Remove all source links but keep the allocated storage.
+  void clear() {
+    m_sourceLinks.clear();
+    m_geometryIds.clear();
+    m_offsets.clear();
+  }
+
+  /// Number of source links.
+  size_t size() const { return m_sourceLinks.size(); }
+  bool empty() const { return m_sourceLinks.empty(); }
+  /// Iterate over all source links in geometry identifier order.
+  const_iterator begin() const { return m_sourceLinks.begin(); }
+  const_iterator end() const { return m_sourceLinks.end(); }
+
+  /// Sorted geometry identifiers of all surfaces with source links.
+  const std::vector<GeometryIdentifier>& geometryIds() const {
+    return m_geometryIds;
+  }
+
+  /// All source links on the given surface.
+  ///
+  /// @param geoId Geometry identifier of the surface
+  /// @return The source links on the surface; empty if there are none
+  Range find(GeometryIdentifier geoId) const {
+    auto it =
+        std::lower_bound(m_geometryIds.begin(), m_geometryIds.end(), geoId);
+    if (it == m_geometryIds.end() or *it != geoId) {
+      return {};
+    }
+    const size_t surface = std::distance(m_geometryIds.begin(), it);
+    assert(surface + 1 < m_offsets.size());
+    return {m_sourceLinks.data() + m_offsets[surface],
+            m_sourceLinks.data() + m_offsets[surface + 1]};
+  }
+
+ private:
+  std::vector<source_link_t> m_sourceLinks;
+  std::vector<GeometryIdentifier> m_geometryIds;
+  // offset of the first source link for every surface plus the total size
+  std::vector<size_t> m_offsets;
+};
+
+}  // namespace Acts
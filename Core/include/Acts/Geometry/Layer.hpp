@@ -171,6 +171,22 @@ class Layer : public virtual GeometryObject {
       const GeometryContext& gctx, const Vector3& position,
       const Vector3& direction, const options_t& options) const;
 
+  /// Decompose Layer into (compatible) surfaces into an existing container
+  ///
+  /// @tparam options_t The navigation options type
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  /// @param position Position parameter for searching
+  /// @param direction Direction parameter for searching
+  /// @param options The templated naivation options
+  /// @param sIntersections Output intersections; previous content is removed
+  /// but the allocated capacity is reused
+  template <typename options_t>
+  void compatibleSurfaces(
+      const GeometryContext& gctx, const Vector3& position,
+      const Vector3& direction, const options_t& options,
+      std::vector<SurfaceIntersection>& sIntersections) const;
+
   /// Surface seen on approach
   ///
   /// @tparam options_t The navigation options type
@@ -14,6 +14,7 @@
 #include "Acts/Geometry/GeometryIdentifier.hpp"
 #include "Acts/Geometry/Layer.hpp"
 #include "Acts/Geometry/Volume.hpp"
+#include "Acts/Geometry/VolumeExtentPrune.hpp"
 #include "Acts/Material/IVolumeMaterial.hpp"
 #include "Acts/Surfaces/BoundaryCheck.hpp"
 #include "Acts/Surfaces/Surface.hpp"
@@ -179,6 +180,19 @@ class TrackingVolume : public Volume {
       const GeometryContext& gctx, const Vector3& position,
       const Vector3& direction, const NavigationOptions<Layer>& options) const;
 
+  /// @brief Resolves the volume into (compatible) Layers
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  /// @param position Position for the search
+  /// @param direction Direction for the search
+  /// @param options The templated navigation options
+  /// @param lIntersections Output intersections; previous content is removed
+  /// but the allocated capacity is reused
+  void compatibleLayers(const GeometryContext& gctx, const Vector3& position,
+                        const Vector3& direction,
+                        const NavigationOptions<Layer>& options,
+                        std::vector<LayerIntersection>& lIntersections) const;
+
   /// @brief Returns all boundary surfaces sorted by the user.
   ///
   /// @tparam options_t Type of navigation options object for decomposition
@@ -196,6 +210,21 @@ class TrackingVolume : public Volume {
       const Vector3& direction, const NavigationOptions<Surface>& options,
       LoggerWrapper logger = getDummyLogger()) const;
 
+  /// @brief Returns all boundary surfaces sorted by the user.
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  /// @param position The position for searching
+  /// @param direction The direction for searching
+  /// @param options The templated navigation options
+  /// @param bIntersections Output intersections; previous content is removed
+  /// but the allocated capacity is reused
+  /// @param logger A @c LoggerWrapper instance
+  void compatibleBoundaries(const GeometryContext& gctx,
+                            const Vector3& position, const Vector3& direction,
+                            const NavigationOptions<Surface>& options,
+                            std::vector<BoundaryIntersection>& bIntersections,
+                            LoggerWrapper logger = getDummyLogger()) const;
+
   /// @brief Return surfaces in given direction from bounding volume hierarchy
   /// @tparam options_t Type of navigation options object for decomposition
   ///
@@ -232,6 +261,10 @@ class TrackingVolume : public Volume {
   /// Return the confined dense volumes
   const MutableTrackingVolumeVector denseVolumes() const;
 
+  /// Return the r/z prune of the navigation candidates - if it exists
+  /// @note only built when the geometry is closed
+  const VolumeExtentPrune* extentPrune() const;
+
   /// @brief Visit all sensitive surfaces
   ///
   /// @param visitor The callable. Will be called for each sensitive surface
@@ -438,6 +471,9 @@ class TrackingVolume : public Volume {
   /// confined dense
   MutableTrackingVolumeVector m_confinedDenseVolumes;
 
+  /// extents of layers and boundaries, built in closeGeometry
+  std::unique_ptr<const VolumeExtentPrune> m_extentPrune = nullptr;
+
   /// Volumes to glue Volumes from the outside
   GlueVolumesDescriptor* m_glueVolumeDescriptor{nullptr};
 
@@ -479,6 +515,10 @@ inline const MutableTrackingVolumeVector TrackingVolume::denseVolumes() const {
   return m_confinedDenseVolumes;
 }
 
+inline const VolumeExtentPrune* TrackingVolume::extentPrune() const {
+  return m_extentPrune.get();
+}
+
 inline std::shared_ptr<const TrackingVolumeArray>
 TrackingVolume::confinedVolumes() const {
   return m_confinedVolumes;
@@ -0,0 +1,87 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace Acts {
+
+class Layer;
+class TrackingVolume;
+
+/// Conservative r/z prune of the navigation candidates of a tracking volume.
+///
+/// Stores the radial extent of cylindrical and the longitudinal extent of
+/// disc-like layers and boundary surfaces, where the cylinders are centered
+/// on and the discs are perpendicular to the global z axis. Before a
+/// candidate is intersected, the navigation checks whether its extent overlaps
+/// the region covered by the straight line to the path limit and skips the
+/// intersection if it does not.
+///
+/// This is not a next-layer lookup: the navigation still visits every
+/// candidate, but the check is a constant-time array access that replaces a
+/// surface intersection for most of them. Objects that are not tabulated,
+/// e.g. planar layers or aligned surfaces, are never pruned.
+class VolumeExtentPrune {
+ public:
+  /// Radial and longitudinal range covered by a straight line segment.
+  struct LineWindow {
+    double rMin = 0;
+    double rMax = 0;
+    double zMin = 0;
+    double zMax = 0;
+
+    /// @param position Start position of the line
+    /// @param direction Signed unit direction of the line
+    /// @param sMin Minimum path length along the line, e.g. the overstep limit
+    /// @param sMax Maximum path length along the line
+    LineWindow(const Vector3& position, const Vector3& direction, double sMin,
+               double sMax);
+  };
+
+  /// Build the prune for a closed tracking volume.
+  ///
+  /// @param volume The closed tracking volume
+  /// @return The prune or a nullptr if the volume has no tabulated objects
+  static std::unique_ptr<const VolumeExtentPrune> create(
+      const TrackingVolume& volume);
+
+  /// Whether a layer of the volume may be reached along the line.
+  ///
+  /// The layer is looked up by its layer identifier.
+  bool mayReach(const Layer& layer, const LineWindow& window) const;
+  /// Whether a boundary surface of the volume may be reached along the line.
+  ///
+  /// @param iboundary Index of the boundary in the boundary surfaces of the
+  ///   volume
+  /// @param window The region covered by the line
+  bool mayReachBoundary(size_t iboundary, const LineWindow& window) const;
+
+ private:
+  struct Entry {
+    // nullptr for objects that are not tabulated
+    const void* object = nullptr;
+    // radial extent if true, longitudinal extent otherwise
+    bool radial = true;
+    double min = 0;
+    double max = 0;
+
+    bool overlaps(const LineWindow& window) const;
+  };
+
+  // indexed by the layer identifier minus one
+  std::vector<Entry> m_layers;
+  // indexed by the position in the boundary surfaces of the volume
+  std::vector<Entry> m_boundaries;
+};
+
+}  // namespace Acts
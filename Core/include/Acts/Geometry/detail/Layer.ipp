@@ -6,8 +6,8 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <algorithm>
 #include <limits>
-#include <map>
 
 namespace Acts {
 
@@ -73,12 +73,20 @@ std::vector<SurfaceIntersection> Layer::compatibleSurfaces(
     const Vector3& direction, const options_t& options) const {
   // the list of valid intersection
   std::vector<SurfaceIntersection> sIntersections;
-  // remember the surfaces for duplicate removal
-  std::map<const Surface*, bool> accepted;
+  compatibleSurfaces(gctx, position, direction, options, sIntersections);
+  return sIntersections;
+}
+
+template <typename options_t>
+void Layer::compatibleSurfaces(
+    const GeometryContext& gctx, const Vector3& position,
+    const Vector3& direction, const options_t& options,
+    std::vector<SurfaceIntersection>& sIntersections) const {
+  sIntersections.clear();
 
   // fast exit - there is nothing to
   if (!m_surfaceArray || !m_approachDescriptor || !options.navDir) {
-    return sIntersections;
+    return;
   }
 
   // reserve a few bins
@@ -101,7 +109,7 @@ std::vector<SurfaceIntersection> Layer::compatibleSurfaces(
     if (endInter) {
       pathLimit = endInter.intersection.pathLength;
     } else {
-      return sIntersections;
+      return;
     }
   } else {
     // compatibleSurfaces() should only be called when on the layer,
@@ -114,10 +122,12 @@ std::vector<SurfaceIntersection> Layer::compatibleSurfaces(
   }
 
   // lemma 0 : accept the surface
-  auto acceptSurface = [&options, &accepted](const Surface& sf,
-                                             bool sensitive = false) -> bool {
-    // check for duplicates
-    if (accepted.find(&sf) != accepted.end()) {
+  auto acceptSurface = [&options, &sIntersections](
+                           const Surface& sf, bool sensitive = false) -> bool {
+    // check for duplicates; the accepted surfaces are exactly the ones with
+    // an intersection and there are only a few of them
+    if (std::any_of(sIntersections.begin(), sIntersections.end(),
+                    [&sf](const auto& sfi) { return sfi.object == &sf; })) {
       return false;
     }
     // surface is sensitive and you're asked to resolve
@@ -160,7 +170,6 @@ std::vector<SurfaceIntersection> Layer::compatibleSurfaces(
       // Now put the right sign on it
       sfi.intersection.pathLength *= std::copysign(1., options.navDir);
       sIntersections.push_back(sfi);
-      accepted[&sf] = true;
     }
     return;
   };
@@ -211,8 +220,6 @@ std::vector<SurfaceIntersection> Layer::compatibleSurfaces(
   } else {
     std::sort(sIntersections.begin(), sIntersections.end(), std::greater<>());
   }
-
-  return sIntersections;
 }
 
 template <typename options_t>
@@ -0,0 +1,266 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Utilities/detail/Axis.hpp"
+#include "Acts/Utilities/detail/Grid.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <vector>
+
+namespace Acts {
+
+/// @brief Identity coordinate transform for cartesian field maps
+///
+/// A coordinate transform for the `CompactBFieldMap` maps global positions
+/// onto the (x,y,z) grid space with a static `toLocal` function and the
+/// interpolated grid value back into a global field vector with a static
+/// `toGlobal` function. Both are resolved at compile time.
+struct CartesianFieldTransform {
+  /// @brief map a global position onto the grid space
+  static Vector3 toLocal(const Vector3& position) { return position; }
+
+  /// @brief map an interpolated field value onto the global field
+  static Vector3 toGlobal(const Vector3& field, const Vector3& /*position*/) {
+    return field;
+  }
+};
+
+/// @ingroup MagneticField
+/// @brief trilinear interpolation on a compact cartesian field map
+///
+/// This is an alternative to the `InterpolatedBFieldMap` for large cartesian
+/// field maps. The field values are stored in single precision as padded
+/// four-component vectors, such that one grid point fills 16 bytes and the
+/// interpolation of all components is done with SIMD operations. The grid
+/// points are stored in blocks of 4x4x4 points, i.e. the corners of a cell
+/// are close in memory in all directions and not only along the fastest axis.
+///
+/// The coordinate transforms are a compile-time policy, see
+/// `CartesianFieldTransform`, instead of type-erased functions. The cache
+/// holds the corners of the last used cell, which are 128 bytes in total.
+///
+/// @tparam transform_t The coordinate transform policy
+template <typename transform_t = CartesianFieldTransform>
+class CompactBFieldMap final {
+ public:
+  using Transform = transform_t;
+  /// The grid type created by `fieldMapperXYZ`
+  using Grid_t = detail::Grid<Vector3, detail::EquidistantAxis,
+                              detail::EquidistantAxis, detail::EquidistantAxis>;
+  /// A stored field value, the last component is padding
+  using Value = Eigen::Array4f;
+
+  /// Number of grid points per block along each axis
+  static constexpr size_t kBlockSize = 4;
+
+  struct Cache {
+    /// @brief Constructor with magnetic field context
+    ///
+    /// @param mcfg the magnetic field context
+    Cache(const MagneticFieldContext& /*mcfg*/) {}
+
+    /// The field values at the corners of the current cell
+    std::array<Value, 8> corners;
+    /// The indices of the current cell, invalid if not initialized
+    std::array<size_t, 3> cell = {{std::numeric_limits<size_t>::max(), 0, 0}};
+  };
+
+  /// @brief create the compact map from a field grid
+  ///
+  /// The value of a grid point is the field at the lower-left edge of its
+  /// bin, as used by the `InterpolatedBFieldMapper`. The overflow bins are
+  /// included such that the interpolation in the last bins matches.
+  ///
+  /// @param [in] grid grid storing the magnetic field values
+  explicit CompactBFieldMap(const Grid_t& grid) {
+    const auto nBins = grid.numLocalBins();
+    const auto min = grid.minPosition();
+    const auto max = grid.maxPosition();
+    for (size_t d = 0; d < 3; ++d) {
+      m_nBins[d] = nBins[d];
+      m_min[d] = min[d];
+      m_max[d] = max[d];
+      m_invBinWidth[d] = nBins[d] / (max[d] - min[d]);
+      // one more point than bins, rounded up to full blocks
+      m_nBlocks[d] = (nBins[d] + kBlockSize) / kBlockSize;
+    }
+    m_values.assign(
+        m_nBlocks[0] * m_nBlocks[1] * m_nBlocks[2] * kBlockSize * kBlockSize *
+            kBlockSize,
+        Value::Zero());
+    for (size_t i = 0; i <= m_nBins[0]; ++i) {
+      for (size_t j = 0; j <= m_nBins[1]; ++j) {
+        for (size_t k = 0; k <= m_nBins[2]; ++k) {
+          const Vector3& field = grid.atLocalBins({{i + 1, j + 1, k + 1}});
+          m_values[storageIndex(i, j, k)] << field.x(), field.y(), field.z(),
+              0.f;
+        }
+      }
+    }
+  }
+
+  /// @brief retrieve magnetic field value
+  ///
+  /// @param [in] position global 3D position
+  ///
+  /// @return magnetic field vector at given position
+  ///
+  /// @note Positions outside the map are clamped to the closest cell.
+  Vector3 getField(const Vector3& position) const {
+    std::array<size_t, 3> cell;
+    Value fraction;
+    locate(position, cell, fraction);
+    std::array<Value, 8> corners;
+    loadCorners(cell, corners);
+    return interpolate(corners, fraction, position);
+  }
+
+  /// @brief retrieve magnetic field value
+  ///
+  /// @param [in] position global 3D position
+  /// @param [in,out] cache Cache object. Contains the corners of the cell
+  ///                 used for interpolation
+  ///
+  /// @return magnetic field vector at given position
+  Vector3 getField(const Vector3& position, Cache& cache) const {
+    std::array<size_t, 3> cell;
+    Value fraction;
+    locate(position, cell, fraction);
+    if (cell != cache.cell) {
+      loadCorners(cell, cache.corners);
+      cache.cell = cell;
+    }
+    return interpolate(cache.corners, fraction, position);
+  }
+
+  /// @brief retrieve magnetic field value & its gradient
+  ///
+  /// @param [in]  position   global 3D position
+  /// @param [out] derivative gradient of magnetic field vector as (3x3) matrix
+  /// @return magnetic field vector
+  ///
+  /// @note currently the derivative is not calculated
+  Vector3 getFieldGradient(const Vector3& position,
+                           ActsMatrix<3, 3>& /*derivative*/) const {
+    return getField(position);
+  }
+
+  /// @brief retrieve magnetic field value & its gradient
+  ///
+  /// @param [in]  position   global 3D position
+  /// @param [out] derivative gradient of magnetic field vector as (3x3) matrix
+  /// @param [in,out] cache Cache object
+  /// @return magnetic field vector
+  ///
+  /// @note currently the derivative is not calculated
+  Vector3 getFieldGradient(const Vector3& position,
+                           ActsMatrix<3, 3>& /*derivative*/,
+                           Cache& cache) const {
+    return getField(position, cache);
+  }
+
+  /// @brief check whether given 3D position is inside look-up domain
+  ///
+  /// @param [in] position global 3D position
+  /// @return @c true if position is inside the defined BField map,
+  ///         otherwise @c false
+  bool isInside(const Vector3& position) const {
+    const Vector3 local = Transform::toLocal(position);
+    for (size_t d = 0; d < 3; ++d) {
+      if (local[d] < m_min[d] or local[d] >= m_max[d]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /// @brief get the number of bins for all axes of the field map
+  const std::array<size_t, 3>& getNBins() const { return m_nBins; }
+
+  /// @brief get the minimum value of all axes of the field map
+  const std::array<double, 3>& getMin() const { return m_min; }
+
+  /// @brief get the maximum value of all axes of the field map
+  const std::array<double, 3>& getMax() const { return m_max; }
+
+ private:
+  /// @brief position of a grid point in the blocked storage
+  size_t storageIndex(size_t i, size_t j, size_t k) const {
+    const size_t block =
+        ((i / kBlockSize) * m_nBlocks[1] + (j / kBlockSize)) * m_nBlocks[2] +
+        (k / kBlockSize);
+    const size_t inBlock =
+        ((i % kBlockSize) * kBlockSize + (j % kBlockSize)) * kBlockSize +
+        (k % kBlockSize);
+    return block * kBlockSize * kBlockSize * kBlockSize + inBlock;
+  }
+
+  /// @brief find the cell and the relative position inside the cell
+  void locate(const Vector3& position, std::array<size_t, 3>& cell,
+              Value& fraction) const {
+    const Vector3 local = Transform::toLocal(position);
+    for (size_t d = 0; d < 3; ++d) {
+      const double u =
+          std::clamp((local[d] - m_min[d]) * m_invBinWidth[d], 0.,
+                     static_cast<double>(m_nBins[d]));
+      cell[d] = std::min(static_cast<size_t>(u), m_nBins[d] - 1);
+      fraction[d] = static_cast<float>(u - cell[d]);
+    }
+    fraction[3] = 0.f;
+  }
+
+  /// @brief copy the field values at the corners of a cell
+  ///
+  /// The corners are ordered as (dx << 2) | (dy << 1) | dz.
+  void loadCorners(const std::array<size_t, 3>& cell,
+                   std::array<Value, 8>& corners) const {
+    for (size_t c = 0; c < 8; ++c) {
+      corners[c] = m_values[storageIndex(cell[0] + ((c >> 2) & 1),
+                                         cell[1] + ((c >> 1) & 1),
+                                         cell[2] + (c & 1))];
+    }
+  }
+
+  /// @brief trilinear interpolation of all field components at once
+  static Vector3 interpolate(const std::array<Value, 8>& c,
+                             const Value& fraction, const Vector3& position) {
+    const float fx = fraction[0];
+    const float fy = fraction[1];
+    const float fz = fraction[2];
+    // along z, then y, then x
+    const Value c00 = c[0] + fz * (c[1] - c[0]);
+    const Value c01 = c[2] + fz * (c[3] - c[2]);
+    const Value c10 = c[4] + fz * (c[5] - c[4]);
+    const Value c11 = c[6] + fz * (c[7] - c[6]);
+    const Value c0 = c00 + fy * (c01 - c00);
+    const Value c1 = c10 + fy * (c11 - c10);
+    const Value field = c0 + fx * (c1 - c0);
+    return Transform::toGlobal(
+        field.template head<3>().template cast<double>().matrix(), position);
+  }
+
+  /// number of bins along each axis
+  std::array<size_t, 3> m_nBins = {{0, 0, 0}};
+  /// number of blocks along each axis
+  std::array<size_t, 3> m_nBlocks = {{0, 0, 0}};
+  /// lower and upper edges of the grid
+  std::array<double, 3> m_min = {{0., 0., 0.}};
+  std::array<double, 3> m_max = {{0., 0., 0.}};
+  /// inverse bin widths
+  std::array<double, 3> m_invBinWidth = {{0., 0., 0.}};
+  /// field values at the grid points in blocked order
+  std::vector<Value> m_values;
+};
+
+}  // namespace Acts
@@ -62,6 +62,17 @@ class AccumulatedMaterialSlab {
   /// unless explicitely requested.
   void trackAverage(bool useEmptyTrack = false);
 
+  /// Add the total average of another accumulation to this one.
+  ///
+  /// @param other the accumulated material from an independent set of tracks
+  ///
+  /// This combines the total averages as if all tracks had been accumulated
+  /// in this object, i.e. each track still contributes equally. It allows the
+  /// accumulation to run on separate objects, e.g. one per thread, which are
+  /// merged at the end. The per-track stores are expected to be empty, i.e.
+  /// any ongoing track accumulation is not included.
+  void merge(const AccumulatedMaterialSlab& other);
+
   /// Return the average material properties from all accumulated tracks.
   ///
   /// @returns Average material properties and the number of contributing tracks
@@ -105,12 +105,26 @@ class AccumulatedSurfaceMaterial {
   void trackAverage(const std::vector<std::array<size_t, 3>>& trackBins = {},
                     bool emptyHit = false);
 
+  /// Average the information accumulated from one mapped track
+  ///
+  /// @param trackBin The single bin that was touched by this event
+  /// @param emptyHit indicator if this is an empty assignment
+  void trackAverage(const std::array<size_t, 3>& trackBin,
+                    bool emptyHit = false);
+
   /// Average the information accumulated from one mapped track
   ///
   /// @param gp global position for the bin assignment
   /// @param emptyHit indicator if this is an empty assignment
   void trackAverage(const Vector3& gp, bool emptyHit = false);
 
+  /// Add the total averages of another accumulation bin by bin
+  ///
+  /// @param other the accumulated material from an independent set of tracks
+  ///
+  /// @throws std::invalid_argument if the binning does not match
+  void merge(const AccumulatedSurfaceMaterial& other);
+
   /// Total average creates SurfaceMaterial
   std::unique_ptr<const ISurfaceMaterial> totalAverage();
 
@@ -9,8 +9,12 @@
 #pragma once
 
 #include "Acts/Definitions/Units.hpp"
+#include "Acts/Material/Material.hpp"
 #include "Acts/Material/MaterialSlab.hpp"
 
+#include <cstddef>
+#include <vector>
+
 namespace Acts {
 
 /// Compute the mean energy loss due to ionisation and excitation.
@@ -129,4 +133,104 @@ float computeMultipleScatteringTheta0(const MaterialSlab& slab, int pdg,
                                       float m, float qOverP,
                                       float q = UnitConstants::e);
 
+/// Tabulated interaction formulas for one particle type in one material.
+///
+/// The logarithmic running terms of the ionisation energy loss are tabulated
+/// on an equidistant grid in log-momentum and interpolated linearly. The
+/// thickness and the energy scale epsilon enter analytically, i.e. one table
+/// serves all slabs of the material. The density correction is also
+/// evaluated analytically such that its threshold does not spoil the
+/// interpolation. The remaining formulas are not faster when tabulated and
+/// are always computed exactly.
+///
+/// The number of grid points is doubled until the relative deviation from
+/// the exact formulas at the interval midpoints, where the interpolation error
+/// is largest, is below the configured tolerance. The deviation of the most
+/// probable energy loss is measured relative to the width of the Landau
+/// distribution. Momenta outside the tabulated range use the exact formulas.
+/// Derivatives are not tabulated.
+class InteractionsTable {
+ public:
+  struct Config {
+    /// Tabulated momentum range
+    float pMin = 100 * UnitConstants::MeV;
+    float pMax = 10 * UnitConstants::TeV;
+    /// Maximum relative deviation from the exact formulas
+    float tolerance = 1e-3f;
+    /// Maximum number of grid points
+    size_t maxPoints = 16384;
+  };
+
+  /// Tabulate the interactions.
+  ///
+  /// @param cfg       The table configuration
+  /// @param material  The material of all slabs passed to the table
+  /// @param pdg       Particle type PDG identifier
+  /// @param m         Particle mass
+  /// @param q         Particle charge, only the magnitude is considered
+  ///
+  /// @throws std::invalid_argument for an invalid configuration or if the
+  ///         tolerance can not be reached with the maximum number of points
+  InteractionsTable(const Config& cfg, const Material& material, int pdg,
+                    float m, float q = UnitConstants::e);
+
+  /// The tabulated material.
+  const Material& material() const { return m_material; }
+  /// The maximum relative deviation from the exact formulas.
+  float maxRelativeError() const { return m_maxRelativeError; }
+  /// The number of grid points.
+  size_t size() const { return m_nodes.size(); }
+
+  /// @see Acts::computeEnergyLossBethe
+  float computeEnergyLossBethe(const MaterialSlab& slab, float qOverP) const;
+  /// @see Acts::computeEnergyLossLandau
+  float computeEnergyLossLandau(const MaterialSlab& slab, float qOverP) const;
+  /// @see Acts::computeEnergyLossLandauSigma
+  float computeEnergyLossLandauSigma(const MaterialSlab& slab,
+                                     float qOverP) const;
+  /// @see Acts::computeEnergyLossLandauSigmaQOverP
+  float computeEnergyLossLandauSigmaQOverP(const MaterialSlab& slab,
+                                           float qOverP) const;
+  /// @see Acts::computeEnergyLossRadiative
+  float computeEnergyLossRadiative(const MaterialSlab& slab,
+                                   float qOverP) const;
+  /// @see Acts::computeEnergyLossMean
+  float computeEnergyLossMean(const MaterialSlab& slab, float qOverP) const;
+  /// @see Acts::computeEnergyLossMode
+  float computeEnergyLossMode(const MaterialSlab& slab, float qOverP) const;
+  /// @see Acts::computeMultipleScatteringTheta0
+  float computeMultipleScatteringTheta0(const MaterialSlab& slab,
+                                        float qOverP) const;
+
+ private:
+  /// Thickness-independent terms at one momentum.
+  struct Node {
+    /// Running terms of the Bethe energy loss and of the most probable
+    /// ionisation loss for unit thickness without the density correction
+    float bethe = 0.0f;
+    float landau = 0.0f;
+  };
+
+  Node computeNode(float momentum) const;
+  void fill(size_t nIntervals);
+  float validate() const;
+  /// Interpolate the terms, returns false outside the tabulated range.
+  bool interpolate(float qOverP, Node& node, float& deltaHalf) const;
+  /// Energy scale epsilon of the ionisation loss for unit thickness.
+  float computeEpsilon(float qOverP) const;
+
+  Config m_cfg;
+  Material m_material;
+  int m_pdg;
+  float m_mass;
+  float m_absQ;
+  /// (K/2) * (Z/A)*rho and log(plasma energy / I) of the material
+  float m_epsilonScale = 0.0f;
+  float m_logPlasmaOverI = 0.0f;
+  float m_logPMin = 0.0f;
+  float m_invStep = 0.0f;
+  float m_maxRelativeError = 0.0f;
+  std::vector<Node> m_nodes;
+};
+
 }  // namespace Acts
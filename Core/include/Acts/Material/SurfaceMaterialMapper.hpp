@@ -29,6 +29,8 @@
 #include <array>
 #include <map>
 #include <memory>
+#include <utility>
+#include <vector>
 
 namespace Acts {
 
@@ -76,6 +78,10 @@ struct MaterialVolume {
 ///
 ///  4) Each 'hit' bin per event is counted and averaged at the end of the run
 ///
+/// The material surfaces are given dense slots when the state is created,
+/// such that the per-track bookkeeping is done with plain arrays that are
+/// kept in the state and reused for every track.
+///
 class SurfaceMaterialMapper {
  public:
   using StraightLinePropagator = Propagator<StraightLineStepper, Navigator>;
@@ -104,6 +110,21 @@ class SurfaceMaterialMapper {
     std::map<GeometryIdentifier, AccumulatedSurfaceMaterial>
         accumulatedMaterial;
 
+    /// The geometry IDs of the material surfaces in slot order, i.e. sorted
+    std::vector<GeometryIdentifier> slotIds;
+
+    /// The accumulated material of each slot, points into accumulatedMaterial
+    std::vector<AccumulatedSurfaceMaterial*> slotMaterial;
+
+    /// The number of material steps assigned to each slot by the current track
+    std::vector<unsigned int> assignedMaterial;
+
+    /// The slots of the mapping surfaces of the current track
+    std::vector<size_t> trackSlots;
+
+    /// The slots and bins touched by the current track
+    std::vector<std::pair<size_t, std::array<size_t, 3>>> touchedMapBins;
+
     /// The created surface material from it
     std::map<GeometryIdentifier, std::unique_ptr<const ISurfaceMaterial>>
         surfaceMaterial;
@@ -143,6 +164,16 @@ class SurfaceMaterialMapper {
                     const MagneticFieldContext& mctx,
                     const TrackingGeometry& tGeometry) const;
 
+  /// @brief Merge the accumulated material of another state
+  ///
+  /// Tracks can be mapped concurrently with one state per thread, created
+  /// with `createState` for the same geometry. The states are merged before
+  /// the maps are finalized.
+  ///
+  /// @param mState The state to merge into
+  /// @param other The state with the material of other tracks, it is consumed
+  void mergeStates(State& mState, State other) const;
+
   /// @brief Method to finalize the maps
   ///
   /// It calls the final run averaging and then transforms
@@ -169,6 +200,20 @@ class SurfaceMaterialMapper {
   void resolveMaterialSurfaces(State& mState,
                                const TrackingVolume& tVolume) const;
 
+  /// @brief assign the dense slots to the resolved material surfaces
+  ///
+  /// @param mState The state with the resolved material surfaces
+  void assignMaterialSlots(State& mState) const;
+
+  /// @brief find the slot of a material surface
+  ///
+  /// @param mState The state with the assigned slots
+  /// @param geoID The geometry ID of the surface
+  ///
+  /// @return the slot, or the number of slots if the surface has none
+  size_t materialSlot(const State& mState,
+                      const GeometryIdentifier& geoID) const;
+
   /// @brief check and insert
   ///
   /// @param mState is the map to be filled
@@ -193,5 +238,8 @@ class SurfaceMaterialMapper {
 
   /// The logging instance
   std::unique_ptr<const Logger> m_logger;
+
+  /// The logging instance of the propagation, shared by all tracks
+  std::unique_ptr<const Logger> m_propagationLogger;
 };
 }  // namespace Acts
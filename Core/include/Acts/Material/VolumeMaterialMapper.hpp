@@ -87,6 +87,12 @@ class VolumeMaterialMapper {
     /// The recorded material per geometry ID
     std::map<GeometryIdentifier, RecordedMaterialVolumePoint> recordedMaterial;
 
+    /// The geometry IDs of the material volumes in slot order, i.e. sorted
+    std::vector<GeometryIdentifier> slotIds;
+
+    /// The recorded material of each slot, points into recordedMaterial
+    std::vector<RecordedMaterialVolumePoint*> slotMaterial;
+
     /// The binning per geometry ID
     std::map<GeometryIdentifier, BinUtility> materialBin;
 
@@ -128,6 +134,16 @@ class VolumeMaterialMapper {
                     const MagneticFieldContext& mctx,
                     const TrackingGeometry& tGeometry) const;
 
+  /// @brief Merge the recorded material of another state
+  ///
+  /// Tracks can be mapped concurrently with one state per thread, created
+  /// with `createState` for the same geometry. The states are merged before
+  /// the maps are finalized.
+  ///
+  /// @param mState The state to merge into
+  /// @param other The state with the material of other tracks, it is consumed
+  void mergeStates(State& mState, State other) const;
+
   /// @brief Method to finalize the maps
   ///
   /// It calls the final run averaging and then transforms
@@ -168,6 +184,20 @@ class VolumeMaterialMapper {
   void resolveMaterialVolume(State& mState,
                              const TrackingVolume& tVolume) const;
 
+  /// @brief assign the dense slots to the resolved material volumes
+  ///
+  /// @param mState The state with the resolved material volumes
+  void assignMaterialSlots(State& mState) const;
+
+  /// @brief find the slot of a material volume
+  ///
+  /// @param mState The state with the assigned slots
+  /// @param geoID The geometry ID of the volume
+  ///
+  /// @return the slot, or the number of slots if the volume has none
+  size_t materialSlot(const State& mState,
+                      const GeometryIdentifier& geoID) const;
+
   /// @brief check and insert
   ///
   /// @param mState is the map to be filled
@@ -202,6 +232,9 @@ class VolumeMaterialMapper {
 
   /// The logging instance
   std::unique_ptr<const Logger> m_logger;
+
+  /// The logging instance of the propagation, shared by all tracks
+  std::unique_ptr<const Logger> m_propagationLogger;
 };
 
 }  // namespace Acts
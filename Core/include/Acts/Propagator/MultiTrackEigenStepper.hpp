@@ -0,0 +1,177 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/EigenStepperError.hpp"
+
+#include <cmath>
+#include <limits>
+#include <system_error>
+#include <vector>
+
+namespace Acts {
+
+/// @brief Runge-Kutta-Nystroem stepper for several tracks at once
+///
+/// Integrates the same equations of motion as the `EigenStepper` with the
+/// default extension, i.e. without material effects and without covariance
+/// transport, for `kLanes` tracks simultaneously. The track states are stored
+/// as structure-of-arrays with one lane per track such that the Runge-Kutta
+/// arithmetic is vectorized across tracks. Only the magnetic field lookup is
+/// done per lane, each lane with its own field cache.
+///
+/// Each lane has its own step size control: lanes whose error estimate is
+/// within the tolerance keep their step while the step size of the remaining
+/// lanes is adapted. Lanes that are not active, e.g. because they reached
+/// their limit or failed, are masked and do not move.
+///
+/// @tparam bfield_t The magnetic field type
+/// @tparam kLanes The number of tracks that are stepped together
+template <typename bfield_t, int kLanes = 4>
+class MultiTrackEigenStepper {
+ public:
+  using BField = bfield_t;
+  /// One value per lane
+  using Lanes = Eigen::Array<double, kLanes, 1>;
+  /// One mask bit per lane
+  using Mask = Eigen::Array<bool, kLanes, 1>;
+  /// One 3D vector per lane, stored component by component
+  using Vectors = Eigen::Array<double, kLanes, 3>;
+
+  static constexpr int lanes = kLanes;
+
+  /// @brief Stepping options shared by all lanes
+  ///
+  /// The defaults follow the `PropagatorOptions`.
+  struct Options {
+    /// Tolerance for the error of the integration
+    double tolerance = 1e-4;
+    /// Cut-off value for the step size
+    double stepSizeCutOff = 0.;
+    /// Maximum number of Runge-Kutta step trials per step
+    unsigned int maxRungeKuttaStepTrials = 10000;
+    /// Mass of the propagated particles
+    double mass = 139.57018 * UnitConstants::MeV;
+  };
+
+  /// @brief State of all lanes
+  struct State {
+    State() = delete;
+
+    /// Constructor with all lanes inactive
+    ///
+    /// @param [in] mctx is the context object for the magnetic field
+    explicit State(const MagneticFieldContext& mctx)
+        : fieldCaches(kLanes, typename BField::Cache(mctx)) {
+      position.setZero();
+      direction.setZero();
+      time.setZero();
+      charge.setZero();
+      momentum.setOnes();
+      stepSize.setZero();
+      pathAccumulated.setZero();
+      active.setConstant(false);
+      error.assign(kLanes, std::error_code());
+    }
+
+    /// Global position and unit direction
+    Vectors position;
+    Vectors direction;
+    /// Time coordinate
+    Lanes time;
+    /// Charge and absolute momentum
+    Lanes charge;
+    Lanes momentum;
+
+    /// The current, signed step size of each lane
+    Lanes stepSize;
+    /// The accumulated path length of each lane
+    Lanes pathAccumulated;
+
+    /// The lanes that are propagated
+    Mask active;
+    /// The reason why a lane was stopped by the stepper
+    std::vector<std::error_code> error;
+
+    /// One field cache per lane
+    std::vector<typename BField::Cache> fieldCaches;
+  };
+
+  /// Constructor
+  ///
+  /// @param bField The magnetic field
+  explicit MultiTrackEigenStepper(BField bField)
+      : m_bField(std::move(bField)) {}
+
+  /// Load track parameters into a lane and activate it
+  ///
+  /// @param [in,out] state The stepper state
+  /// @param [in] lane The lane to be loaded
+  /// @param [in] gctx is the context object for the geometry
+  /// @param [in] par The track parameters at start
+  /// @param [in] ndir The propagation direction w.r.t momentum
+  /// @param [in] ssize is the maximum step size
+  template <typename charge_t>
+  void loadLane(State& state, int lane, const GeometryContext& gctx,
+                const SingleBoundTrackParameters<charge_t>& par,
+                NavigationDirection ndir = forward,
+                double ssize = std::numeric_limits<double>::max()) const {
+    state.position.row(lane) = par.position(gctx).transpose();
+    state.direction.row(lane) = par.unitDirection().transpose();
+    state.time[lane] = par.time();
+    state.charge[lane] = par.charge();
+    state.momentum[lane] = par.absoluteMomentum();
+    state.stepSize[lane] = ndir * std::abs(ssize);
+    state.pathAccumulated[lane] = 0.;
+    state.active[lane] = true;
+    state.error[lane] = std::error_code();
+  }
+
+  /// The free parameters of a lane
+  ///
+  /// @param [in] state The stepper state
+  /// @param [in] lane The requested lane
+  FreeVector freeParameters(const State& state, int lane) const {
+    FreeVector pars;
+    pars.template segment<3>(eFreePos0) = state.position.row(lane).transpose();
+    pars[eFreeTime] = state.time[lane];
+    pars.template segment<3>(eFreeDir0) = state.direction.row(lane).transpose();
+    const double q = state.charge[lane];
+    pars[eFreeQOverP] = (q == 0. ? 1. : q) / state.momentum[lane];
+    return pars;
+  }
+
+  /// Perform one Runge-Kutta step for all active lanes
+  ///
+  /// Lanes whose step size can not be adapted are deactivated and their
+  /// error is set accordingly.
+  ///
+  /// @param [in,out] state The stepper state
+  /// @param [in] options The stepping options
+  /// @param [in] limit The maximum absolute step length of each lane
+  ///
+  /// @return The signed step length of each lane, zero for inactive lanes
+  Lanes step(State& state, const Options& options, const Lanes& limit) const;
+
+ private:
+  /// Field lookup for the lanes in the mask
+  void getField(State& state, const Vectors& positions, const Mask& mask,
+                Vectors& bField) const;
+
+  /// Magnetic field
+  BField m_bField;
+};
+
+}  // namespace Acts
+
+#include "Acts/Propagator/MultiTrackEigenStepper.ipp"
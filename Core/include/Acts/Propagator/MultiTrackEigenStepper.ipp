@@ -0,0 +1,140 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+template <typename B, int N>
+void Acts::MultiTrackEigenStepper<B, N>::getField(State& state,
+                                                  const Vectors& positions,
+                                                  const Mask& mask,
+                                                  Vectors& bField) const {
+  for (int lane = 0; lane < N; ++lane) {
+    if (mask[lane]) {
+      const Vector3 pos = positions.row(lane).transpose().matrix();
+      bField.row(lane) =
+          m_bField.getField(pos, state.fieldCaches[lane]).transpose().array();
+    }
+  }
+}
+
+template <typename B, int N>
+auto Acts::MultiTrackEigenStepper<B, N>::step(State& state,
+                                              const Options& options,
+                                              const Lanes& limit) const
+    -> Lanes {
+  // Lane-wise cross product
+  const auto cross = [](const Vectors& a, const Vectors& b) -> Vectors {
+    Vectors c;
+    c.col(0) = a.col(1) * b.col(2) - a.col(2) * b.col(1);
+    c.col(1) = a.col(2) * b.col(0) - a.col(0) * b.col(2);
+    c.col(2) = a.col(0) * b.col(1) - a.col(1) * b.col(0);
+    return c;
+  };
+
+  // Stop a lane that can not be stepped any further
+  Mask pending = state.active;
+  Lanes h = Lanes::Zero();
+  const auto stopLane = [&](int lane, EigenStepperError error) {
+    state.active[lane] = false;
+    state.error[lane] = error;
+    pending[lane] = false;
+    h[lane] = 0.;
+  };
+
+  if (not state.active.any()) {
+    return h;
+  }
+
+  // The signed step of the active lanes, restricted to the limit
+  h = state.active.select(
+      state.stepSize.sign() * state.stepSize.abs().min(limit.abs()), 0.);
+  const Lanes qop = state.charge / state.momentum;
+  const Vectors& pos = state.position;
+  const Vectors& dir = state.direction;
+
+  // Runge-Kutta integrator state; the field of masked lanes stays untouched
+  Vectors bFirst = Vectors::Zero();
+  Vectors bMiddle = Vectors::Zero();
+  Vectors bLast = Vectors::Zero();
+  Vectors k1, k2, k3, k4;
+  Lanes h2, halfH, errorEstimate;
+
+  // First Runge-Kutta point (at current position)
+  getField(state, pos, state.active, bFirst);
+  k1 = cross(dir, bFirst).colwise() * qop;
+
+  // Select and adjust the appropriate Runge-Kutta step size for each lane as
+  // given in ATL-SOFT-PUB-2009-001. Lanes that are within tolerance keep
+  // their step and field values, so re-evaluating them reproduces the same
+  // result.
+  size_t nStepTrials = 0;
+  while (true) {
+    h2 = h * h;
+    halfH = h * 0.5;
+
+    // Second and third Runge-Kutta point
+    const Vectors pos1 =
+        pos + dir.colwise() * halfH + k1.colwise() * (h2 * 0.125);
+    getField(state, pos1, pending, bMiddle);
+    k2 = cross(dir + k1.colwise() * halfH, bMiddle).colwise() * qop;
+    k3 = cross(dir + k2.colwise() * halfH, bMiddle).colwise() * qop;
+
+    // Last Runge-Kutta point
+    const Vectors pos2 = pos + dir.colwise() * h + k3.colwise() * (h2 * 0.5);
+    getField(state, pos2, pending, bLast);
+    k4 = cross(dir + k3.colwise() * h, bLast).colwise() * qop;
+
+    // Compute and check the local integration error estimate
+    errorEstimate =
+        (h2 * (k1 - k2 - k3 + k4).abs().rowwise().sum()).max(1e-20);
+    pending = pending && (errorEstimate > options.tolerance);
+    if (not pending.any()) {
+      break;
+    }
+
+    // Adapt the step size of the lanes that are not within tolerance
+    const Lanes stepSizeScaling =
+        (options.tolerance / (2. * errorEstimate).abs())
+            .pow(0.25)
+            .max(0.25)
+            .min(4.);
+    h = pending.select(h * stepSizeScaling, h);
+    state.stepSize = pending.select(h, state.stepSize);
+    for (int lane = 0; lane < N; ++lane) {
+      if (not pending[lane]) {
+        continue;
+      }
+      if (h[lane] * h[lane] <
+          options.stepSizeCutOff * options.stepSizeCutOff) {
+        // Not moving due to too low momentum needs an aborter
+        stopLane(lane, EigenStepperError::StepSizeStalled);
+      } else if (nStepTrials > options.maxRungeKuttaStepTrials) {
+        // Too many trials, have to abort
+        stopLane(lane, EigenStepperError::StepSizeAdjustmentFailed);
+      }
+    }
+    if (not pending.any()) {
+      break;
+    }
+    nStepTrials++;
+  }
+
+  // Update the lanes that moved according to the equations of motion
+  using VectorMask = Eigen::Array<bool, N, 3>;
+  const VectorMask moved = state.active.template replicate<1, 3>();
+  h2 = h * h;
+  const Vectors newPos =
+      pos + dir.colwise() * h + (k1 + k2 + k3).colwise() * (h2 / 6.);
+  Vectors newDir = dir + (k1 + 2. * (k2 + k3) + k4).colwise() * (h / 6.);
+  newDir.colwise() /= newDir.matrix().rowwise().norm().array();
+  state.position = moved.select(newPos, state.position);
+  state.direction = moved.select(newDir, state.direction);
+
+  const Lanes dtds = (1. + (options.mass / state.momentum).square()).sqrt();
+  state.time += h * dtds;
+  state.pathAccumulated += h;
+  return h;
+}
@@ -0,0 +1,142 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Common.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/PropagatorError.hpp"
+#include "Acts/Utilities/Result.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace Acts {
+
+/// @brief Propagation of many tracks with a multi-track stepper
+///
+/// The tracks are propagated in groups of `stepper_t::lanes` tracks without
+/// navigation, i.e. up to a path limit, in the way the `Propagator` does it
+/// with a `VoidNavigator`. A lane that reaches its limit or fails is masked
+/// while the remaining lanes of the group continue.
+///
+/// @tparam stepper_t The multi-track stepper, e.g. `MultiTrackEigenStepper`
+template <typename stepper_t>
+class MultiTrackPropagator {
+ public:
+  using Stepper = stepper_t;
+  using Lanes = typename Stepper::Lanes;
+
+  /// @brief Options of the multi-track propagation
+  struct Options {
+    /// Options of the stepper
+    typename Stepper::Options stepping;
+    /// Propagation direction
+    NavigationDirection direction = forward;
+    /// Absolute maximum path length
+    double pathLimit = std::numeric_limits<double>::max();
+    /// Absolute maximum step size
+    double maxStepSize = std::numeric_limits<double>::max();
+    /// Maximum number of steps for one propagate call
+    unsigned int maxSteps = 1000;
+  };
+
+  /// @brief Result of one propagated track
+  struct TrackResult {
+    /// The free parameters at the end of the propagation
+    FreeVector endParameters = FreeVector::Zero();
+    /// The signed path length
+    double pathLength = 0.;
+    /// Number of propagation steps
+    unsigned int steps = 0;
+  };
+
+  /// Constructor from the stepper
+  explicit MultiTrackPropagator(Stepper stepper)
+      : m_stepper(std::move(stepper)) {}
+
+  /// Propagate a set of tracks to the path limit
+  ///
+  /// @tparam parameters_t Type of the start parameters
+  ///
+  /// @param [in] gctx is the context object for the geometry
+  /// @param [in] mctx is the context object for the magnetic field
+  /// @param [in] start The start parameters of all tracks
+  /// @param [in] options The propagation options
+  ///
+  /// @return One result per track in input order
+  template <typename parameters_t>
+  std::vector<Result<TrackResult>> propagate(
+      const GeometryContext& gctx, const MagneticFieldContext& mctx,
+      const std::vector<parameters_t>& start, const Options& options) const {
+    constexpr int nLanes = Stepper::lanes;
+    std::vector<Result<TrackResult>> results;
+    results.reserve(start.size());
+
+    for (size_t first = 0; first < start.size(); first += nLanes) {
+      const int nTracks =
+          static_cast<int>(std::min<size_t>(nLanes, start.size() - first));
+      typename Stepper::State state(mctx);
+      for (int lane = 0; lane < nTracks; ++lane) {
+        m_stepper.loadLane(state, lane, gctx, start[first + lane],
+                           options.direction, options.maxStepSize);
+      }
+
+      std::vector<unsigned int> steps(nLanes, 0);
+      std::vector<std::error_code> errors(nLanes);
+      while (true) {
+        // stop the lanes at the path or step limit, see PathLimitReached
+        const Lanes remaining =
+            std::abs(options.pathLimit) - state.pathAccumulated.abs();
+        for (int lane = 0; lane < nTracks; ++lane) {
+          if (not state.active[lane]) {
+            continue;
+          }
+          if (remaining[lane] < s_onSurfaceTolerance) {
+            state.active[lane] = false;
+          } else if (steps[lane] >= options.maxSteps) {
+            state.active[lane] = false;
+            errors[lane] = PropagatorError::StepCountLimitReached;
+          }
+        }
+        if (not state.active.any()) {
+          break;
+        }
+        const Lanes h = m_stepper.step(state, options.stepping, remaining);
+        for (int lane = 0; lane < nTracks; ++lane) {
+          steps[lane] += (h[lane] != 0.) ? 1 : 0;
+        }
+      }
+
+      for (int lane = 0; lane < nTracks; ++lane) {
+        if (state.error[lane]) {
+          results.push_back(state.error[lane]);
+        } else if (errors[lane]) {
+          results.push_back(errors[lane]);
+        } else {
+          TrackResult result;
+          result.endParameters = m_stepper.freeParameters(state, lane);
+          result.pathLength = state.pathAccumulated[lane];
+          result.steps = steps[lane];
+          results.push_back(std::move(result));
+        }
+      }
+    }
+    return results;
+  }
+
+ private:
+  Stepper m_stepper;
+};
+
+}  // namespace Acts
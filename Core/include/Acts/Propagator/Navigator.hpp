@@ -21,6 +21,7 @@
 
 #include <iomanip>
 #include <iterator>
+#include <map>
 #include <sstream>
 #include <string>
 
@@ -743,7 +744,7 @@ class Navigator {
 
             state.navigation.navSurfaceIter =
                 state.navigation.navSurfaces.begin();
-            state.navigation.navLayers = {};
+            state.navigation.navLayers.clear();
             state.navigation.navLayerIter = state.navigation.navLayers.end();
             // The stepper updates the step size ( single / multi component)
             stepper.updateStepSize(state.stepping,
@@ -880,11 +881,12 @@ class Navigator {
                    << stepper.direction(state.stepping).transpose());
 
       // Evaluate the boundary surfaces
-      state.navigation.navBoundaries =
-          state.navigation.currentVolume->compatibleBoundaries(
-              state.geoContext, stepper.position(state.stepping),
-              stepper.direction(state.stepping), navOpts,
-              LoggerWrapper{logger()});
+      // the candidates are written into the existing container such that its
+      // memory is reused for every volume
+      state.navigation.currentVolume->compatibleBoundaries(
+          state.geoContext, stepper.position(state.stepping),
+          stepper.direction(state.stepping), navOpts,
+          state.navigation.navBoundaries, LoggerWrapper{logger()});
       // The number of boundary candidates
       if (logger().doPrint(Logging::VERBOSE)) {
         auto dstream = logger().log(Logging::VERBOSE);
@@ -1074,9 +1076,10 @@ class Navigator {
                                 : stepper.overstepLimit(state.stepping);
 
     // get the surfaces
-    state.navigation.navSurfaces = navLayer->compatibleSurfaces(
-        state.geoContext, stepper.position(state.stepping),
-        stepper.direction(state.stepping), navOpts);
+    navLayer->compatibleSurfaces(state.geoContext,
+                                 stepper.position(state.stepping),
+                                 stepper.direction(state.stepping), navOpts,
+                                 state.navigation.navSurfaces);
     // the number of layer candidates
     if (!state.navigation.navSurfaces.empty()) {
       logger().log(Logging::VERBOSE, [&](auto dstream) {
@@ -1137,10 +1140,9 @@ class Navigator {
     navOpts.pathLimit = state.stepping.stepSize.value(ConstrainedStep::aborter);
     navOpts.overstepLimit = stepper.overstepLimit(state.stepping);
     // Request the compatible layers
-    state.navigation.navLayers =
-        state.navigation.currentVolume->compatibleLayers(
-            state.geoContext, stepper.position(state.stepping),
-            stepper.direction(state.stepping), navOpts);
+    state.navigation.currentVolume->compatibleLayers(
+        state.geoContext, stepper.position(state.stepping),
+        stepper.direction(state.stepping), navOpts, state.navigation.navLayers);
 
     // Layer candidates have been found
     if (!state.navigation.navLayers.empty()) {
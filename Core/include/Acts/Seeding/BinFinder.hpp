@@ -10,10 +10,14 @@
 
 #include "Acts/Seeding/SpacePointGrid.hpp"
 
-#include <vector>
+#include <boost/container/small_vector.hpp>
 
 namespace Acts {
 
+/// Global indices of the bins of a space point neighborhood. A neighborhood
+/// of up to 3x3 bins is stored inline without dynamic memory allocation.
+using NeighborhoodBins = boost::container::small_vector<size_t, 9>;
+
 /// @class BinFinder
 /// The BinFinder is used by the ISPGroupSelector. It can be
 /// used to find both bins that could be bottom bins as well as bins that could
@@ -30,7 +34,7 @@ class BinFinder {
   /// @param phiBin phi index of bin with middle space points
   /// @param zBin z index of bin with middle space points
   /// @param binnedSP phi-z grid containing all bins
-  std::vector<size_t> findBins(
+  NeighborhoodBins findBins(
       size_t phiBin, size_t zBin,
       const SpacePointGrid<external_spacepoint_t>* binnedSP);
 };
@@ -14,6 +14,7 @@
 #include "Acts/Seeding/SeedfinderConfig.hpp"
 #include "Acts/Seeding/SpacePointGrid.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
@@ -30,7 +31,7 @@ class NeighborhoodIterator {
 
   NeighborhoodIterator() = delete;
 
-  NeighborhoodIterator(std::vector<size_t> indices,
+  NeighborhoodIterator(const NeighborhoodBins& indices,
                        const SpacePointGrid<external_spacepoint_t>* spgrid) {
     m_grid = spgrid;
     m_indices = indices;
@@ -41,7 +42,7 @@ class NeighborhoodIterator {
     }
   }
 
-  NeighborhoodIterator(std::vector<size_t> indices,
+  NeighborhoodIterator(const NeighborhoodBins& indices,
                        const SpacePointGrid<external_spacepoint_t>* spgrid,
                        size_t curInd, sp_it_t curIt) {
     m_grid = spgrid;
@@ -53,7 +54,7 @@ class NeighborhoodIterator {
     }
   }
   static NeighborhoodIterator<external_spacepoint_t> begin(
-      std::vector<size_t> indices,
+      const NeighborhoodBins& indices,
       const SpacePointGrid<external_spacepoint_t>* spgrid) {
     auto nIt = NeighborhoodIterator<external_spacepoint_t>(indices, spgrid);
     // advance until first non-empty bin or last bin
@@ -102,7 +103,7 @@ class NeighborhoodIterator {
   sp_it_t m_curIt;
   sp_it_t m_binEnd;
   // number of bins
-  std::vector<size_t> m_indices;
+  NeighborhoodBins m_indices;
   // current bin
   size_t m_curInd;
   const Acts::SpacePointGrid<external_spacepoint_t>* m_grid;
@@ -115,7 +116,7 @@ template <typename external_spacepoint_t>
 class Neighborhood {
  public:
   Neighborhood() = delete;
-  Neighborhood(std::vector<size_t> indices,
+  Neighborhood(const NeighborhoodBins& indices,
                const SpacePointGrid<external_spacepoint_t>* spgrid) {
     m_indices = indices;
     m_spgrid = spgrid;
@@ -131,7 +132,7 @@ class Neighborhood {
   }
 
  private:
-  std::vector<size_t> m_indices;
+  NeighborhoodBins m_indices;
   const SpacePointGrid<external_spacepoint_t>* m_spgrid;
 };
 
@@ -151,7 +152,7 @@ class BinnedSPGroupIterator {
     // set current & neighbor bins only if bin indices valid
     if (phiIndex <= phiZbins[0] && zIndex <= phiZbins[1]) {
       currentBin =
-          std::vector<size_t>{grid->globalBinFromLocalBins({phiIndex, zIndex})};
+          NeighborhoodBins{grid->globalBinFromLocalBins({phiIndex, zIndex})};
       bottomBinIndices = m_bottomBinFinder->findBins(phiIndex, zIndex, grid);
       topBinIndices = m_topBinFinder->findBins(phiIndex, zIndex, grid);
       outputIndex++;
@@ -217,9 +218,9 @@ class BinnedSPGroupIterator {
 
  private:
   // middle spacepoint bin
-  std::vector<size_t> currentBin;
-  std::vector<size_t> bottomBinIndices;
-  std::vector<size_t> topBinIndices;
+  NeighborhoodBins currentBin;
+  NeighborhoodBins bottomBinIndices;
+  NeighborhoodBins topBinIndices;
   const SpacePointGrid<external_spacepoint_t>* grid;
   size_t phiIndex = 1;
   size_t zIndex = 1;
@@ -250,6 +251,24 @@ class BinnedSPGroup {
 
   size_t size() { return m_binnedSP.size(); }
 
+  /// Number of (phi, z) groups, i.e. of bins with middle space points.
+  size_t numGroups() const {
+    auto phiZbins = m_binnedSP->numLocalBins();
+    return phiZbins[0] * phiZbins[1];
+  }
+
+  /// Random access to a single group.
+  ///
+  /// Groups are numbered in the same order in which they are visited by the
+  /// iterator. Different groups can be accessed concurrently.
+  /// @param index group index in [0, numGroups())
+  BinnedSPGroupIterator<external_spacepoint_t> group(size_t index) const {
+    auto phiZbins = m_binnedSP->numLocalBins();
+    return BinnedSPGroupIterator<external_spacepoint_t>(
+        m_binnedSP.get(), m_bottomBinFinder.get(), m_topBinFinder.get(),
+        index / phiZbins[1] + 1, index % phiZbins[1] + 1);
+  }
+
   BinnedSPGroupIterator<external_spacepoint_t> begin() {
     return BinnedSPGroupIterator<external_spacepoint_t>(
         m_binnedSP.get(), m_bottomBinFinder.get(), m_topBinFinder.get());
@@ -266,7 +285,7 @@ class BinnedSPGroup {
   // grid with ownership of all InternalSpacePoint
   std::unique_ptr<Acts::SpacePointGrid<external_spacepoint_t>> m_binnedSP;
 
-  // BinFinder must return std::vector<Acts::Seeding::Bin> with content of
+  // BinFinder must return the global indices of bins with the content of
   // each bin sorted in r (ascending)
   std::shared_ptr<BinFinder<external_spacepoint_t>> m_topBinFinder;
   std::shared_ptr<BinFinder<external_spacepoint_t>> m_bottomBinFinder;
@@ -81,6 +81,20 @@ Acts::BinnedSPGroup<external_spacepoint_t>::BinnedSPGroup(
       bin.push_back(std::move(isp));
     }
   }
+  // space points with delta r < rbin size can still be out of order; sort
+  // each bin such that its content is guaranteed to be ascending in r, which
+  // the seed finder uses to restrict the doublet search to a radius window
+  for (size_t binIndex = 0; binIndex < grid->size(); ++binIndex) {
+    auto& bin = grid->at(binIndex);
+    std::stable_sort(
+        bin.begin(), bin.end(),
+        [](const std::unique_ptr<
+               const InternalSpacePoint<external_spacepoint_t>>& a,
+           const std::unique_ptr<
+               const InternalSpacePoint<external_spacepoint_t>>& b) {
+          return a->radius() < b->radius();
+        });
+  }
   m_binnedSP = std::move(grid);
   m_bottomBinFinder = botBinFinder;
   m_topBinFinder = tBinFinder;
@@ -8,7 +8,7 @@
 
 #pragma once
 
-#include <vector>
+#include <array>
 
 namespace Acts {
 template <typename SpacePoint>
@@ -23,11 +23,12 @@ class Seed {
   Seed(const Seed&) = default;
   Seed& operator=(const Seed&);
 
-  const std::vector<const SpacePoint*>& sp() const { return m_spacepoints; }
+  const std::array<const SpacePoint*, 3>& sp() const { return m_spacepoints; }
   double z() const { return m_zvertex; }
 
  private:
-  std::vector<const SpacePoint*> m_spacepoints;
+  // fixed-size storage avoids a heap allocation per seed
+  std::array<const SpacePoint*, 3> m_spacepoints;
   float m_zvertex;
 };
 
@@ -37,11 +38,9 @@ class Seed {
 
 template <typename SpacePoint>
 Seed<SpacePoint>::Seed(const SpacePoint& b, const SpacePoint& m,
-                       const SpacePoint& u, float vertex) {
+                       const SpacePoint& u, float vertex)
+    : m_spacepoints({&b, &m, &u}) {
   m_zvertex = vertex;
-  m_spacepoints.push_back(&b);
-  m_spacepoints.push_back(&m);
-  m_spacepoints.push_back(&u);
 }
 
 }  // namespace Acts
@@ -40,6 +40,8 @@ class SeedFilter {
   /// @param origin on the z axis as defined by bottom and middle space point
   /// @return vector of pairs containing seed weight and seed for all valid
   /// created seeds
+  /// @note the default implementation forwards to the overload taking an
+  /// output container, which is the one called by the Seedfinder
   virtual std::vector<std::pair<
       float, std::unique_ptr<const InternalSeed<external_spacepoint_t>>>>
   filterSeeds_2SpFixed(
@@ -49,6 +51,27 @@ class SeedFilter {
       std::vector<float>& invHelixDiameterVec,
       std::vector<float>& impactParametersVec, float zOrigin) const;
 
+  /// Create InternalSeeds for the all seeds with the same bottom and middle
+  /// space point and discard all others.
+  /// @param bottomSP fixed bottom space point
+  /// @param middleSP fixed middle space point
+  /// @param topSpVec vector containing all space points that may be compatible
+  /// with both bottom and middle space point
+  /// @param origin on the z axis as defined by bottom and middle space point
+  /// @param compatibleSeedR scratch buffer for the compatible seed radii
+  /// @param outCont container to which pairs of seed weight and seed are
+  /// appended for all valid created seeds
+  virtual void filterSeeds_2SpFixed(
+      const InternalSpacePoint<external_spacepoint_t>& bottomSP,
+      const InternalSpacePoint<external_spacepoint_t>& middleSP,
+      std::vector<const InternalSpacePoint<external_spacepoint_t>*>& topSpVec,
+      std::vector<float>& invHelixDiameterVec,
+      std::vector<float>& impactParametersVec, float zOrigin,
+      std::vector<float>& compatibleSeedR,
+      std::vector<std::pair<
+          float, std::unique_ptr<const InternalSeed<external_spacepoint_t>>>>&
+          outCont) const;
+
   /// Filter seeds once all seeds for one middle space point have been created
   /// @param seedsPerSpM vector of pairs containing weight and seed for all
   /// for all seeds with the same middle space point
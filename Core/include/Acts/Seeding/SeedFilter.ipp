@@ -31,12 +31,29 @@ SeedFilter<external_spacepoint_t>::filterSeeds_2SpFixed(
   std::vector<std::pair<
       float, std::unique_ptr<const InternalSeed<external_spacepoint_t>>>>
       selectedSeeds;
+  std::vector<float> compatibleSeedR;
+  filterSeeds_2SpFixed(bottomSP, middleSP, topSpVec, invHelixDiameterVec,
+                       impactParametersVec, zOrigin, compatibleSeedR,
+                       selectedSeeds);
+  return selectedSeeds;
+}
 
+template <typename external_spacepoint_t>
+void SeedFilter<external_spacepoint_t>::filterSeeds_2SpFixed(
+    const InternalSpacePoint<external_spacepoint_t>& bottomSP,
+    const InternalSpacePoint<external_spacepoint_t>& middleSP,
+    std::vector<const InternalSpacePoint<external_spacepoint_t>*>& topSpVec,
+    std::vector<float>& invHelixDiameterVec,
+    std::vector<float>& impactParametersVec, float zOrigin,
+    std::vector<float>& compatibleSeedR,
+    std::vector<std::pair<
+        float, std::unique_ptr<const InternalSeed<external_spacepoint_t>>>>&
+        outCont) const {
   for (size_t i = 0; i < topSpVec.size(); i++) {
     // if two compatible seeds with high distance in r are found, compatible
     // seeds span 5 layers
     // -> very good seed
-    std::vector<float> compatibleSeedR;
+    compatibleSeedR.clear();
 
     float invHelixDiameter = invHelixDiameterVec[i];
     float lowerLimitCurv = invHelixDiameter - m_cfg.deltaInvHelixDiameter;
@@ -93,11 +110,10 @@ SeedFilter<external_spacepoint_t>::filterSeeds_2SpFixed(
         continue;
       }
     }
-    selectedSeeds.push_back(std::make_pair(
+    outCont.push_back(std::make_pair(
         weight, std::make_unique<const InternalSeed<external_spacepoint_t>>(
                     bottomSP, middleSP, *topSpVec[i], zOrigin)));
   }
-  return selectedSeeds;
 }
 
 // after creating all seeds with a common middle space point, filter again
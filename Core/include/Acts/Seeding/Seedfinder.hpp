@@ -11,6 +11,8 @@
 #include "Acts/Seeding/InternalSeed.hpp"
 #include "Acts/Seeding/InternalSpacePoint.hpp"
 #include "Acts/Seeding/SeedfinderConfig.hpp"
+#include "Acts/Seeding/SpacePointSoA.hpp"
+#include "Acts/Utilities/SequentialExecutor.hpp"
 
 #include <array>
 #include <list>
@@ -30,6 +32,26 @@ struct LinCircle {
   float U;
   float V;
 };
+
+/// Structure-of-arrays version of LinCircle used by the vectorized kernels.
+struct LinCircleSoA {
+  std::vector<float> Zo;
+  std::vector<float> cotTheta;
+  std::vector<float> iDeltaR;
+  std::vector<float> Er;
+  std::vector<float> U;
+  std::vector<float> V;
+
+  void resize(size_t n) {
+    Zo.resize(n);
+    cotTheta.resize(n);
+    iDeltaR.resize(n);
+    Er.resize(n);
+    U.resize(n);
+    V.resize(n);
+  }
+};
+
 template <typename external_spacepoint_t, typename platform_t = void*>
 class Seedfinder {
   ///////////////////////////////////////////////////////////////////
@@ -37,6 +59,46 @@ class Seedfinder {
   ///////////////////////////////////////////////////////////////////
 
  public:
+  /// Scratch buffers used during the seed finding for one group.
+  ///
+  /// The buffers only grow, i.e. after the largest group has been processed
+  /// no further memory is allocated for them. Each thread must use its own
+  /// state; a state can be reused for any number of groups and events.
+  struct State {
+    // pointer backend
+    std::vector<const InternalSpacePoint<external_spacepoint_t>*>
+        compatBottomSP;
+    std::vector<const InternalSpacePoint<external_spacepoint_t>*> compatTopSP;
+    std::vector<LinCircle> linCircleBottom;
+    std::vector<LinCircle> linCircleTop;
+
+    // structure-of-arrays backend
+    SpacePointSoA<external_spacepoint_t> bottoms;
+    SpacePointSoA<external_spacepoint_t> tops;
+    SpacePointSoA<external_spacepoint_t> compatBottomSoA;
+    SpacePointSoA<external_spacepoint_t> compatTopSoA;
+    LinCircleSoA linCircleBottomSoA;
+    LinCircleSoA linCircleTopSoA;
+    std::vector<int> mask;
+    std::vector<float> curvaturesPerTop;
+    std::vector<float> impactParametersPerTop;
+
+    // triplet candidates for one bottom and middle space point
+    std::vector<const InternalSpacePoint<external_spacepoint_t>*> topSpVec;
+    std::vector<float> curvatures;
+    std::vector<float> impactParameters;
+    // used by the seed filter to count compatible seeds
+    std::vector<float> compatibleSeedR;
+    // seed candidates for one middle space point
+    std::vector<std::pair<
+        float, std::unique_ptr<const InternalSeed<external_spacepoint_t>>>>
+        seedsPerSpM;
+
+    /// Number of bottom and top candidates tested for compatibility with a
+    /// middle space point, accumulated over all calls. Monitoring only.
+    size_t numDoubletCandidates = 0;
+  };
+
   /// The only constructor. Requires a config object.
   /// @param config the configuration for the Seedfinder
   Seedfinder(Acts::SeedfinderConfig<external_spacepoint_t> config);
@@ -56,12 +118,68 @@ class Seedfinder {
   /// @param top group of space points to be used as outermost SP in a seed.
   /// Ranges must return pointers.
   /// Ranges must be separate objects for each parallel call.
+  /// If `useSoABackend` is set in the configuration the space points are
+  /// copied into a structure-of-arrays layout once per group and the
+  /// compatibility checks run as vectorizable loops over contiguous arrays.
+  /// Both backends produce identical seeds.
   /// @return vector in which all found seeds for this group are stored.
   template <typename sp_range_t>
   std::vector<Seed<external_spacepoint_t>> createSeedsForGroup(
       sp_range_t bottomSPs, sp_range_t middleSPs, sp_range_t topSPs) const;
 
+  /// Create all seeds from the space points in the three iterators reusing
+  /// the scratch buffers in the given state.
+  /// @param state scratch buffers, must not be shared between threads
+  /// @param outputVec container to which the found seeds are appended
+  /// @param bottom group of space points to be used as innermost SP in a seed.
+  /// @param middle group of space points to be used as middle SP in a seed.
+  /// @param top group of space points to be used as outermost SP in a seed.
+  template <typename sp_range_t>
+  void createSeedsForGroup(State& state,
+                           std::vector<Seed<external_spacepoint_t>>& outputVec,
+                           sp_range_t bottomSPs, sp_range_t middleSPs,
+                           sp_range_t topSPs) const;
+
+  /// Create the seeds for all groups of the binned space points.
+  ///
+  /// The groups are handed to the executor as index ranges that may be
+  /// processed concurrently, each range with its own state. The result does
+  /// not depend on the execution order.
+  /// @param spGroup binned space points with random access to the groups,
+  ///   e.g. BinnedSPGroup
+  /// @param executor distributes the groups, see SequentialExecutor
+  /// @return the seeds for each group in the iteration order of the groups
+  template <typename sp_group_t, typename executor_t = SequentialExecutor>
+  std::vector<std::vector<Seed<external_spacepoint_t>>> createSeedsForGroups(
+      const sp_group_t& spGroup, executor_t&& executor = executor_t()) const;
+
  private:
+  template <typename sp_range_t>
+  void createSeedsForGroupSoA(
+      State& state, std::vector<Seed<external_spacepoint_t>>& outputVec,
+      sp_range_t& bottomSPs, sp_range_t& middleSPs, sp_range_t& topSPs) const;
+
+  /// Select all candidates compatible with the middle space point.
+  ///
+  /// Only the candidates within the compatible radius window of each
+  /// r-sorted range are tested.
+  /// @param candidates bottom or top space point candidates
+  /// @param spM middle space point
+  /// @param bottom whether the candidates are bottom space points
+  /// @param mask scratch buffer for the per-candidate compatibility flag
+  /// @param compatSP output container for the compatible space points
+  /// @return number of tested candidates
+  size_t searchDoublets(
+      const SpacePointSoA<external_spacepoint_t>& candidates,
+      const InternalSpacePoint<external_spacepoint_t>& spM, bool bottom,
+      std::vector<int>& mask,
+      SpacePointSoA<external_spacepoint_t>& compatSP) const;
+
+  void transformCoordinates(
+      const SpacePointSoA<external_spacepoint_t>& vec,
+      const InternalSpacePoint<external_spacepoint_t>& spM, bool bottom,
+      LinCircleSoA& linCircleVec) const;
+
   void transformCoordinates(
       std::vector<const InternalSpacePoint<external_spacepoint_t>*>& vec,
       const InternalSpacePoint<external_spacepoint_t>& spM, bool bottom,
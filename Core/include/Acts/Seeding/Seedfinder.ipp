@@ -8,6 +8,7 @@
 
 #include "Acts/Seeding/SeedFilter.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <numeric>
 #include <type_traits>
@@ -39,7 +40,31 @@ template <typename sp_range_t>
 std::vector<Seed<external_spacepoint_t>>
 Seedfinder<external_spacepoint_t, platform_t>::createSeedsForGroup(
     sp_range_t bottomSPs, sp_range_t middleSPs, sp_range_t topSPs) const {
+  State state;
   std::vector<Seed<external_spacepoint_t>> outputVec;
+  createSeedsForGroup(state, outputVec, std::move(bottomSPs),
+                      std::move(middleSPs), std::move(topSPs));
+  return outputVec;
+}
+
+template <typename external_spacepoint_t, typename platform_t>
+template <typename sp_range_t>
+void Seedfinder<external_spacepoint_t, platform_t>::createSeedsForGroup(
+    State& state, std::vector<Seed<external_spacepoint_t>>& outputVec,
+    sp_range_t bottomSPs, sp_range_t middleSPs, sp_range_t topSPs) const {
+  if (m_config.useSoABackend) {
+    createSeedsForGroupSoA(state, outputVec, bottomSPs, middleSPs, topSPs);
+    return;
+  }
+  auto& compatBottomSP = state.compatBottomSP;
+  auto& compatTopSP = state.compatTopSP;
+  auto& linCircleBottom = state.linCircleBottom;
+  auto& linCircleTop = state.linCircleTop;
+  auto& topSpVec = state.topSpVec;
+  auto& curvatures = state.curvatures;
+  auto& impactParameters = state.impactParameters;
+  auto& seedsPerSpM = state.seedsPerSpM;
+
   for (auto spM : middleSPs) {
     float rM = spM->radius();
     float zM = spM->z();
@@ -47,17 +72,18 @@ Seedfinder<external_spacepoint_t, platform_t>::createSeedsForGroup(
     float varianceZM = spM->varianceZ();
 
     // bottom space point
-    std::vector<const InternalSpacePoint<external_spacepoint_t>*>
-        compatBottomSP;
+    compatBottomSP.clear();
 
     for (auto bottomSP : bottomSPs) {
+      ++state.numDoubletCandidates;
       float rB = bottomSP->radius();
       float deltaR = rM - rB;
       // if r-distance is too big, try next SP in bin
       if (deltaR > m_config.deltaRMax) {
         continue;
       }
-      // if r-distance is too small, continue because bins are NOT r-sorted
+      // if r-distance is too small, continue because the range spans several
+      // bins and is only r-sorted within each bin
       if (deltaR < m_config.deltaRMin) {
         continue;
       }
@@ -79,9 +105,10 @@ Seedfinder<external_spacepoint_t, platform_t>::createSeedsForGroup(
       continue;
     }
 
-    std::vector<const InternalSpacePoint<external_spacepoint_t>*> compatTopSP;
+    compatTopSP.clear();
 
     for (auto topSP : topSPs) {
+      ++state.numDoubletCandidates;
       float rT = topSP->radius();
       float deltaR = rT - rM;
       // this condition is the opposite of the condition for bottom SP
@@ -108,20 +135,13 @@ Seedfinder<external_spacepoint_t, platform_t>::createSeedsForGroup(
     }
     // contains parameters required to calculate circle with linear equation
     // ...for bottom-middle
-    std::vector<LinCircle> linCircleBottom;
+    linCircleBottom.clear();
     // ...for middle-top
-    std::vector<LinCircle> linCircleTop;
+    linCircleTop.clear();
     transformCoordinates(compatBottomSP, *spM, true, linCircleBottom);
     transformCoordinates(compatTopSP, *spM, false, linCircleTop);
 
-    // create vectors here to avoid reallocation in each loop
-    std::vector<const InternalSpacePoint<external_spacepoint_t>*> topSpVec;
-    std::vector<float> curvatures;
-    std::vector<float> impactParameters;
-
-    std::vector<std::pair<
-        float, std::unique_ptr<const InternalSeed<external_spacepoint_t>>>>
-        seedsPerSpM;
+    seedsPerSpM.clear();
     size_t numBotSP = compatBottomSP.size();
     size_t numTopSP = compatTopSP.size();
 
@@ -235,20 +255,294 @@ Seedfinder<external_spacepoint_t, platform_t>::createSeedsForGroup(
         }
       }
       if (!topSpVec.empty()) {
-        std::vector<std::pair<
-            float, std::unique_ptr<const InternalSeed<external_spacepoint_t>>>>
-            sameTrackSeeds;
-        sameTrackSeeds = std::move(m_config.seedFilter->filterSeeds_2SpFixed(
+        m_config.seedFilter->filterSeeds_2SpFixed(
             *compatBottomSP[b], *spM, topSpVec, curvatures, impactParameters,
-            Zob));
-        seedsPerSpM.insert(seedsPerSpM.end(),
-                           std::make_move_iterator(sameTrackSeeds.begin()),
-                           std::make_move_iterator(sameTrackSeeds.end()));
+            Zob, state.compatibleSeedR, seedsPerSpM);
       }
     }
     m_config.seedFilter->filterSeeds_1SpFixed(seedsPerSpM, outputVec);
   }
-  return outputVec;
+}
+
+template <typename external_spacepoint_t, typename platform_t>
+template <typename sp_group_t, typename executor_t>
+std::vector<std::vector<Seed<external_spacepoint_t>>>
+Seedfinder<external_spacepoint_t, platform_t>::createSeedsForGroups(
+    const sp_group_t& spGroup, executor_t&& executor) const {
+  // one output slot per group keeps the result independent of the execution
+  // order and avoids any synchronisation between the tasks
+  std::vector<std::vector<Seed<external_spacepoint_t>>> seeds(
+      spGroup.numGroups());
+  executor(seeds.size(), [&](size_t begin, size_t end) {
+    State state;
+    for (size_t igroup = begin; igroup < end; ++igroup) {
+      auto group = spGroup.group(igroup);
+      createSeedsForGroup(state, seeds[igroup], group.bottom(), group.middle(),
+                          group.top());
+    }
+  });
+  return seeds;
+}
+
+template <typename external_spacepoint_t, typename platform_t>
+template <typename sp_range_t>
+void Seedfinder<external_spacepoint_t, platform_t>::createSeedsForGroupSoA(
+    State& state, std::vector<Seed<external_spacepoint_t>>& outputVec,
+    sp_range_t& bottomSPs, sp_range_t& middleSPs, sp_range_t& topSPs) const {
+  // copy the candidates of the whole group into contiguous arrays once
+  // instead of following the space point pointers for every middle SP
+  auto& bottoms = state.bottoms;
+  auto& tops = state.tops;
+  bottoms.fill(bottomSPs);
+  tops.fill(topSPs);
+  if (bottoms.empty() || tops.empty()) {
+    return;
+  }
+
+  auto& compatBottomSP = state.compatBottomSoA;
+  auto& compatTopSP = state.compatTopSoA;
+  auto& linCircleBottom = state.linCircleBottomSoA;
+  auto& linCircleTop = state.linCircleTopSoA;
+  auto& mask = state.mask;
+  auto& curvaturesPerTop = state.curvaturesPerTop;
+  auto& impactParametersPerTop = state.impactParametersPerTop;
+  auto& topSpVec = state.topSpVec;
+  auto& curvatures = state.curvatures;
+  auto& impactParameters = state.impactParameters;
+  auto& seedsPerSpM = state.seedsPerSpM;
+
+  // local copies of the configuration to allow vectorization of the loops
+  const float minHelixDiameter2 = m_config.minHelixDiameter2;
+  const float pT2perRadius = m_config.pT2perRadius;
+  const float pTPerHelixRadius = m_config.pTPerHelixRadius;
+  const float maxPtScattering = m_config.maxPtScattering;
+  const float sigmaScattering = m_config.sigmaScattering;
+  const float impactMax = m_config.impactMax;
+  const float pTscatter = m_config.highland / m_config.maxPtScattering;
+  const float pT2scatterMaxPt = pTscatter * pTscatter;
+
+  for (auto spM : middleSPs) {
+    float rM = spM->radius();
+    float varianceRM = spM->varianceR();
+    float varianceZM = spM->varianceZ();
+
+    state.numDoubletCandidates +=
+        searchDoublets(bottoms, *spM, true, mask, compatBottomSP);
+    if (compatBottomSP.empty()) {
+      continue;
+    }
+    state.numDoubletCandidates +=
+        searchDoublets(tops, *spM, false, mask, compatTopSP);
+    if (compatTopSP.empty()) {
+      continue;
+    }
+    transformCoordinates(compatBottomSP, *spM, true, linCircleBottom);
+    transformCoordinates(compatTopSP, *spM, false, linCircleTop);
+
+    size_t numBotSP = compatBottomSP.size();
+    size_t numTopSP = compatTopSP.size();
+    mask.resize(numTopSP);
+    curvaturesPerTop.resize(numTopSP);
+    impactParametersPerTop.resize(numTopSP);
+
+    const float* topCotTheta = linCircleTop.cotTheta.data();
+    const float* topIDeltaR = linCircleTop.iDeltaR.data();
+    const float* topEr = linCircleTop.Er.data();
+    const float* topU = linCircleTop.U.data();
+    const float* topV = linCircleTop.V.data();
+    int* accept = mask.data();
+    float* curvaturesOut = curvaturesPerTop.data();
+    float* impactOut = impactParametersPerTop.data();
+
+    seedsPerSpM.clear();
+    for (size_t b = 0; b < numBotSP; b++) {
+      float Zob = linCircleBottom.Zo[b];
+      float cotThetaB = linCircleBottom.cotTheta[b];
+      float Vb = linCircleBottom.V[b];
+      float Ub = linCircleBottom.U[b];
+      float ErB = linCircleBottom.Er[b];
+      float iDeltaRB = linCircleBottom.iDeltaR[b];
+
+      // see createSeedsForGroup for the derivation of the cuts below
+      float iSinTheta2 = (1. + cotThetaB * cotThetaB);
+      float scatteringInRegion2 = m_config.maxScatteringAngle2 * iSinTheta2;
+      scatteringInRegion2 *=
+          m_config.sigmaScattering * m_config.sigmaScattering;
+
+      // evaluate all cuts for all top SPs without early exits
+      for (size_t t = 0; t < numTopSP; t++) {
+        float error2 =
+            topEr[t] + ErB +
+            2 * (cotThetaB * topCotTheta[t] * varianceRM + varianceZM) *
+                iDeltaRB * topIDeltaR[t];
+        float deltaCotTheta = cotThetaB - topCotTheta[t];
+        float deltaCotTheta2 = deltaCotTheta * deltaCotTheta;
+        bool largeDeltaCotTheta = (deltaCotTheta2 - error2 > 0);
+        float error = std::sqrt(error2);
+        float dCotThetaMinusError2 =
+            deltaCotTheta2 + error2 - 2 * std::abs(deltaCotTheta) * error;
+
+        float dU = topU[t] - Ub;
+        float A = (topV[t] - Vb) / dU;
+        float S2 = 1. + A * A;
+        float B = Vb - A * Ub;
+        float B2 = B * B;
+        float iHelixDiameter2 = B2 / S2;
+        float pT2scatter = 4 * iHelixDiameter2 * pT2perRadius;
+        float pT = pTPerHelixRadius * std::sqrt(S2 / B2) / 2.;
+        pT2scatter = (pT > maxPtScattering) ? pT2scatterMaxPt : pT2scatter;
+        float p2scatter = pT2scatter * iSinTheta2;
+        float Im = std::abs((A - B * rM) * rM);
+
+        bool scatteringCut =
+            largeDeltaCotTheta &&
+            ((dCotThetaMinusError2 > scatteringInRegion2) ||
+             (dCotThetaMinusError2 >
+              p2scatter * sigmaScattering * sigmaScattering));
+        accept[t] = !scatteringCut && (dU != 0.) &&
+                    !(S2 < B2 * minHelixDiameter2) && (Im <= impactMax);
+        curvaturesOut[t] = B / std::sqrt(S2);
+        impactOut[t] = Im;
+      }
+
+      topSpVec.clear();
+      curvatures.clear();
+      impactParameters.clear();
+      for (size_t t = 0; t < numTopSP; t++) {
+        if (accept[t]) {
+          topSpVec.push_back(compatTopSP.sp[t]);
+          curvatures.push_back(curvaturesOut[t]);
+          impactParameters.push_back(impactOut[t]);
+        }
+      }
+      if (!topSpVec.empty()) {
+        m_config.seedFilter->filterSeeds_2SpFixed(
+            *compatBottomSP.sp[b], *spM, topSpVec, curvatures,
+            impactParameters, Zob, state.compatibleSeedR, seedsPerSpM);
+      }
+    }
+    m_config.seedFilter->filterSeeds_1SpFixed(seedsPerSpM, outputVec);
+  }
+}
+
+template <typename external_spacepoint_t, typename platform_t>
+size_t Seedfinder<external_spacepoint_t, platform_t>::searchDoublets(
+    const SpacePointSoA<external_spacepoint_t>& candidates,
+    const InternalSpacePoint<external_spacepoint_t>& spM, bool bottom,
+    std::vector<int>& mask,
+    SpacePointSoA<external_spacepoint_t>& compatSP) const {
+  const float rM = spM.radius();
+  const float zM = spM.z();
+  const float deltaRMin = m_config.deltaRMin;
+  const float deltaRMax = m_config.deltaRMax;
+  const float cotThetaMax = m_config.cotThetaMax;
+  const float collisionRegionMin = m_config.collisionRegionMin;
+  const float collisionRegionMax = m_config.collisionRegionMax;
+  // bottom SPs must be at smaller, top SPs at larger radius
+  const float sign = bottom ? -1. : 1.;
+  auto deltaROf = [=](float r) { return sign * (r - rM); };
+
+  mask.resize(candidates.size());
+  const float* r = candidates.r.data();
+  const float* z = candidates.z.data();
+  int* compatible = mask.data();
+
+  compatSP.clear();
+  size_t numCandidates = 0;
+  size_t rangeBegin = 0;
+  for (size_t rangeEnd : candidates.sortedRangeEnds) {
+    // within a range sorted in r the candidates passing the delta r cuts form
+    // a contiguous window that can be found by binary search. the predicates
+    // use the same arithmetic as the cuts below and are monotonic in r.
+    const float* first = r + rangeBegin;
+    const float* last = r + rangeEnd;
+    const float* windowBegin;
+    const float* windowEnd;
+    if (bottom) {
+      windowBegin = std::partition_point(
+          first, last, [&](float ri) { return deltaROf(ri) > deltaRMax; });
+      windowEnd = std::partition_point(windowBegin, last, [&](float ri) {
+        return deltaROf(ri) >= deltaRMin;
+      });
+    } else {
+      windowBegin = std::partition_point(
+          first, last, [&](float ri) { return deltaROf(ri) < deltaRMin; });
+      windowEnd = std::partition_point(windowBegin, last, [&](float ri) {
+        return deltaROf(ri) <= deltaRMax;
+      });
+    }
+    rangeBegin = rangeEnd;
+
+    const size_t begin = windowBegin - r;
+    const size_t end = windowEnd - r;
+    numCandidates += end - begin;
+    for (size_t i = begin; i < end; ++i) {
+      float deltaR = deltaROf(r[i]);
+      // ratio Z/R (forward angle) of space point duplet
+      float cotTheta = (z[i] - zM) / (r[i] - rM);
+      // duplet origin on the z axis
+      float zOrigin = zM - rM * cotTheta;
+      compatible[i] = (deltaR >= deltaRMin) && (deltaR <= deltaRMax) &&
+                      !(std::fabs(cotTheta) > cotThetaMax) &&
+                      !(zOrigin < collisionRegionMin) &&
+                      !(zOrigin > collisionRegionMax);
+    }
+    for (size_t i = begin; i < end; ++i) {
+      if (compatible[i]) {
+        compatSP.push_back(candidates, i);
+      }
+    }
+  }
+  return numCandidates;
+}
+
+template <typename external_spacepoint_t, typename platform_t>
+void Seedfinder<external_spacepoint_t, platform_t>::transformCoordinates(
+    const SpacePointSoA<external_spacepoint_t>& vec,
+    const InternalSpacePoint<external_spacepoint_t>& spM, bool bottom,
+    LinCircleSoA& linCircleVec) const {
+  const float xM = spM.x();
+  const float yM = spM.y();
+  const float zM = spM.z();
+  const float rM = spM.radius();
+  const float varianceZM = spM.varianceZ();
+  const float varianceRM = spM.varianceR();
+  const float cosPhiM = xM / rM;
+  const float sinPhiM = yM / rM;
+  const int bottomFactor = 1 * (int(!bottom)) - 1 * (int(bottom));
+
+  const size_t n = vec.size();
+  linCircleVec.resize(n);
+  const float* x = vec.x.data();
+  const float* y = vec.y.data();
+  const float* z = vec.z.data();
+  const float* varianceR = vec.varianceR.data();
+  const float* varianceZ = vec.varianceZ.data();
+  float* Zo = linCircleVec.Zo.data();
+  float* cotTheta = linCircleVec.cotTheta.data();
+  float* iDeltaROut = linCircleVec.iDeltaR.data();
+  float* Er = linCircleVec.Er.data();
+  float* U = linCircleVec.U.data();
+  float* V = linCircleVec.V.data();
+  // same transformation as the pointer-based version below
+  for (size_t i = 0; i < n; ++i) {
+    float deltaX = x[i] - xM;
+    float deltaY = y[i] - yM;
+    float deltaZ = z[i] - zM;
+    float xNew = deltaX * cosPhiM + deltaY * sinPhiM;
+    float yNew = deltaY * cosPhiM - deltaX * sinPhiM;
+    float iDeltaR2 = 1. / (deltaX * deltaX + deltaY * deltaY);
+    float iDeltaR = std::sqrt(iDeltaR2);
+    float cot_theta = deltaZ * iDeltaR * bottomFactor;
+    cotTheta[i] = cot_theta;
+    Zo[i] = zM - rM * cot_theta;
+    iDeltaROut[i] = iDeltaR;
+    U[i] = xNew * iDeltaR2;
+    V[i] = yNew * iDeltaR2;
+    Er[i] = ((varianceZM + varianceZ[i]) +
+             (cot_theta * cot_theta) * (varianceRM + varianceR[i])) *
+            iDeltaR2;
+  }
 }
 
 template <typename external_spacepoint_t, typename platform_t>
@@ -93,6 +93,10 @@ struct SeedfinderConfig {
   // find seeds within 5sigma error ellipse
   float sigmaError = 5;
 
+  // use the structure-of-arrays space point layout and the vectorizable
+  // doublet and triplet kernels instead of iterating over space point pointers
+  bool useSoABackend = false;
+
   // derived values, set on Seedfinder construction
   float highland = 0;
   float maxScatteringAngle2 = 0;
@@ -0,0 +1,112 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Seeding/InternalSpacePoint.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace Acts {
+
+/// Structure-of-arrays storage for internal space points.
+///
+/// Keeps the coordinates and variances used by the seed finding in separate
+/// contiguous float arrays such that the doublet and triplet compatibility
+/// checks can be written as simple loops the compiler is able to vectorize.
+/// The original space points are kept alongside to create the final seeds.
+template <typename external_spacepoint_t>
+struct SpacePointSoA {
+  using InternalSpacePointType = InternalSpacePoint<external_spacepoint_t>;
+
+  std::vector<float> x;
+  std::vector<float> y;
+  std::vector<float> z;
+  std::vector<float> r;
+  std::vector<float> varianceR;
+  std::vector<float> varianceZ;
+  std::vector<const InternalSpacePointType*> sp;
+  /// End indices of the consecutive ranges that are sorted in radius.
+  ///
+  /// Only set by fill(). Since the bins of the space point grid are sorted
+  /// in r, each range usually corresponds to one bin of a neighborhood.
+  std::vector<size_t> sortedRangeEnds;
+
+  /// Number of stored space points.
+  size_t size() const { return sp.size(); }
+  /// Whether the container is empty.
+  bool empty() const { return sp.empty(); }
+
+  /// Remove all space points while keeping the allocated memory.
+  void clear() {
+    x.clear();
+    y.clear();
+    z.clear();
+    r.clear();
+    varianceR.clear();
+    varianceZ.clear();
+    sp.clear();
+    sortedRangeEnds.clear();
+  }
+
+  /// Reserve memory for the given number of space points.
+  void reserve(size_t n) {
+    x.reserve(n);
+    y.reserve(n);
+    z.reserve(n);
+    r.reserve(n);
+    varianceR.reserve(n);
+    varianceZ.reserve(n);
+    sp.reserve(n);
+  }
+
+  /// Append a single space point.
+  void push_back(const InternalSpacePointType* isp) {
+    x.push_back(isp->x());
+    y.push_back(isp->y());
+    z.push_back(isp->z());
+    r.push_back(isp->radius());
+    varianceR.push_back(isp->varianceR());
+    varianceZ.push_back(isp->varianceZ());
+    sp.push_back(isp);
+  }
+
+  /// Append a single space point from another container.
+  ///
+  /// @param other the container to copy from
+  /// @param i index of the space point in the other container
+  void push_back(const SpacePointSoA& other, size_t i) {
+    x.push_back(other.x[i]);
+    y.push_back(other.y[i]);
+    z.push_back(other.z[i]);
+    r.push_back(other.r[i]);
+    varianceR.push_back(other.varianceR[i]);
+    varianceZ.push_back(other.varianceZ[i]);
+    sp.push_back(other.sp[i]);
+  }
+
+  /// Replace the content with all space points from the given range.
+  ///
+  /// @param spRange range that returns pointers to internal space points
+  template <typename sp_range_t>
+  void fill(sp_range_t& spRange) {
+    clear();
+    for (auto isp : spRange) {
+      if (!r.empty() && isp->radius() < r.back()) {
+        sortedRangeEnds.push_back(r.size());
+      }
+      push_back(isp);
+    }
+    if (!r.empty()) {
+      sortedRangeEnds.push_back(r.size());
+    }
+  }
+};
+
+}  // namespace Acts
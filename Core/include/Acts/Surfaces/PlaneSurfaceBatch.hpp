@@ -0,0 +1,111 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Surfaces/BoundaryCheck.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/Intersection.hpp"
+
+#include <vector>
+
+namespace Acts {
+
+class PlaneSurface;
+
+/// @class PlaneSurfaceBatch
+///
+/// A set of plane surfaces in structure-of-arrays layout that are intersected
+/// with one straight line at once.
+///
+/// The local axes, normals and centers of all surfaces are stored as columns
+/// such that the intersection of all surfaces is evaluated with vectorized
+/// Eigen array expressions. The boundary check is vectorized for rectangular
+/// bounds with an absolute tolerance; other bounds and chi2 based checks fall
+/// back to the per-surface check for the lanes that are inside the plane.
+///
+/// The results are identical to `PlaneSurface::intersect` up to rounding.
+///
+/// @note The surface placement is cached for the given geometry context, the
+///       batch has to be rebuilt if the alignment changes.
+class PlaneSurfaceBatch {
+ public:
+  using Scalars = Eigen::Array<ActsScalar, Eigen::Dynamic, 1>;
+
+  /// Intersections of one line with all surfaces of a batch.
+  ///
+  /// Can be reused between calls to avoid reallocation.
+  struct Intersections {
+    /// Signed path length, infinite for unreachable surfaces
+    Scalars pathLength;
+    /// Local positions of the intersections
+    Scalars loc0;
+    Scalars loc1;
+    /// The intersection status including the boundary check
+    std::vector<Intersection3D::Status> status;
+  };
+
+  /// Constructor from plane surfaces
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  /// @param surfaces The plane surfaces of the batch
+  PlaneSurfaceBatch(const GeometryContext& gctx,
+                    std::vector<const PlaneSurface*> surfaces);
+
+  /// Number of surfaces in the batch
+  size_t size() const { return m_surfaces.size(); }
+
+  /// The surfaces in batch order
+  const std::vector<const PlaneSurface*>& surfaces() const {
+    return m_surfaces;
+  }
+
+  /// Intersect all surfaces with a straight line
+  ///
+  /// @param position The start position of the line
+  /// @param direction The direction of the line
+  /// @param bcheck The boundary check directive
+  /// @param intersections [in,out] The intersections in batch order
+  void intersect(const Vector3& position, const Vector3& direction,
+                 const BoundaryCheck& bcheck,
+                 Intersections& intersections) const;
+
+  /// Convert a single batch result into a surface intersection
+  ///
+  /// @param intersections The result of `intersect`
+  /// @param index The surface index within the batch
+  /// @param position The start position used for the intersection
+  /// @param direction The direction used for the intersection
+  SurfaceIntersection surfaceIntersection(const Intersections& intersections,
+                                          size_t index,
+                                          const Vector3& position,
+                                          const Vector3& direction) const;
+
+ private:
+  std::vector<const PlaneSurface*> m_surfaces;
+
+  /// Local axes and normals, one row per surface
+  Eigen::Matrix<ActsScalar, Eigen::Dynamic, 3> m_axis0;
+  Eigen::Matrix<ActsScalar, Eigen::Dynamic, 3> m_axis1;
+  Eigen::Matrix<ActsScalar, Eigen::Dynamic, 3> m_normal;
+  /// Projections of the centers onto the axes and normals
+  Scalars m_center0;
+  Scalars m_center1;
+  Scalars m_centerN;
+  /// Rectangular bounds, unbounded for non-rectangular lanes
+  Scalars m_min0;
+  Scalars m_max0;
+  Scalars m_min1;
+  Scalars m_max1;
+  /// Lanes whose bounds are not rectangular
+  std::vector<size_t> m_generic;
+};
+
+}  // namespace Acts
@@ -16,6 +16,7 @@
 #include "Acts/EventData/MeasurementHelpers.hpp"
 #include "Acts/EventData/MultiTrajectory.hpp"
 #include "Acts/EventData/MultiTrajectoryHelpers.hpp"
+#include "Acts/EventData/SourceLinkIndex.hpp"
 #include "Acts/EventData/TrackParameters.hpp"
 #include "Acts/EventData/TrackStatePropMask.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
@@ -34,9 +35,13 @@
 #include "Acts/Utilities/Helpers.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/Result.hpp"
+#include "Acts/Utilities/SequentialExecutor.hpp"
 
 #include <functional>
 #include <memory>
+#include <optional>
+#include <system_error>
+#include <type_traits>
 #include <unordered_map>
 
 namespace Acts {
@@ -137,8 +142,9 @@ struct CombinatorialKalmanFilterOptions {
 
 template <typename source_link_t>
 struct CombinatorialKalmanFilterResult {
-  // Fitted states that the actor has handled.
-  MultiTrajectory<source_link_t> fittedStates;
+  // Fitted states that the actor has handled. The trajectory is shared by
+  // all tracks found within one findTracks call.
+  std::shared_ptr<MultiTrajectory<source_link_t>> fittedStates;
 
   // The indices of the 'tip' of the tracks stored in multitrajectory.
   std::vector<size_t> trackTips;
@@ -248,9 +254,9 @@ class CombinatorialKalmanFilter {
     /// The target surface
     const Surface* targetSurface = nullptr;
 
-    /// Allows retrieving measurements for a surface
-    std::unordered_map<GeometryIdentifier, std::vector<source_link_t>>
-        inputMeasurements;
+    /// Allows retrieving measurements for a surface. Not owned, the index
+    /// must outlive the propagation.
+    const SourceLinkIndex<source_link_t>* inputMeasurements = nullptr;
 
     /// Whether to consider multiple scattering.
     bool multipleScattering = true;
@@ -261,6 +267,9 @@ class CombinatorialKalmanFilter {
     /// Whether to run smoothing to get fitted parameter
     bool smoothing = true;
 
+    /// The trajectory where the track states of all seeds are stored
+    std::shared_ptr<MultiTrajectory<source_link_t>> trajectory;
+
     /// @brief CombinatorialKalmanFilter actor operation
     ///
     /// @tparam propagator_state_t Type of the Propagagor state
@@ -278,6 +287,12 @@ class CombinatorialKalmanFilter {
         return;
       }
 
+      if (result.fittedStates == nullptr) {
+        result.fittedStates =
+            trajectory ? trajectory
+                       : std::make_shared<MultiTrajectory<source_link_t>>();
+      }
+
       ACTS_VERBOSE("CombinatorialKalmanFilter step");
 
       // This following is added due to the fact that the navigation
@@ -334,12 +349,12 @@ class CombinatorialKalmanFilter {
           const auto& lastActiveTip = result.activeTips.back().first;
           // Get the index of previous state
           const auto& iprevious =
-              result.fittedStates.getTrackState(lastActiveTip).previous();
+              result.fittedStates->getTrackState(lastActiveTip).previous();
           // Find the track states which have the same previous state and remove
           // them from active tips
           while (not result.activeTips.empty()) {
             const auto& [currentTip, tipState] = result.activeTips.back();
-            if (result.fittedStates.getTrackState(currentTip).previous() !=
+            if (result.fittedStates->getTrackState(currentTip).previous() !=
                 iprevious) {
               break;
             }
@@ -454,7 +469,7 @@ class CombinatorialKalmanFilter {
       // Remember the propagation state has been reset
       result.reset = true;
       auto currentState =
-          result.fittedStates.getTrackState(result.activeTips.back().first);
+          result.fittedStates->getTrackState(result.activeTips.back().first);
 
       // Reset the navigation state
       state.navigation = typename propagator_t::NavigatorState();
@@ -500,8 +515,8 @@ class CombinatorialKalmanFilter {
       size_t nBranchesOnSurface = 0;
 
       // Try to find the surface in the measurement surfaces
-      auto sourcelink_it = inputMeasurements.find(surface->geometryId());
-      if (sourcelink_it != inputMeasurements.end()) {
+      const auto sourcelinks = inputMeasurements->find(surface->geometryId());
+      if (not sourcelinks.empty()) {
         // Screen output message
         ACTS_VERBOSE("Measurement surface " << surface->geometryId()
                                             << " detected.");
@@ -517,9 +532,6 @@ class CombinatorialKalmanFilter {
             stepper.boundState(state.stepping, *surface, false);
         const auto& boundParams = std::get<BoundTrackParameters>(boundState);
 
-        // Get all source links on the surface
-        const auto& sourcelinks = sourcelink_it->second;
-
         // Calibrate all the source links on the surface since the selection has
         // to be done based on calibrated measurement
         std::vector<BoundVariantMeasurement<source_link_t>> measurements;
@@ -555,6 +567,20 @@ class CombinatorialKalmanFilter {
 
         // Remember the tip of the neighbor state on this surface
         size_t neighborTip = SIZE_MAX;
+        // The track states added on this surface. Measurement track states
+        // are updated together once all of them are added and only the
+        // successfully updated ones become new branches.
+        struct AddedState {
+          size_t index;
+          size_t tip;
+          TipState tipState;
+          bool isSourcelinkShared;
+        };
+        std::vector<AddedState> addedStates;
+        addedStates.reserve(result.measurementCandidateIndices.size());
+        std::vector<typename MultiTrajectory<source_link_t>::TrackStateProxy>
+            measurementStates;
+        measurementStates.reserve(result.measurementCandidateIndices.size());
         // Loop over the selected measurements
         for (const auto& index : result.measurementCandidateIndices) {
           // Determine if predicted parameter is already contained in
@@ -589,39 +615,59 @@ class CombinatorialKalmanFilter {
                          : TrackStatePropMask::All);
 
           // Add measurement/outlier track state to the multitrajectory
-          auto addStateRes = addSourcelinkState(
+          auto [currentTip, tipState] = addSourcelinkState(
               stateMask, boundState, sourcelinks[index], measurements[index],
-              isOutlier, result, state.geoContext, prevTip, prevTipState,
-              neighborTip, sharedTip, logger);
-          if (addStateRes.ok()) {
-            const auto& [currentTip, tipState] = addStateRes.value();
-            // Remember the track state tip for this stored source link
-            if (not isSourcelinkShared) {
-              auto& sourcelinkTipsOnSurface = result.sourcelinkTips[surface];
-              sourcelinkTipsOnSurface.emplace(index, currentTip);
-            }
-            // Remember the tip of neighbor state on this surface
-            neighborTip = currentTip;
-
-            // Check if need to stop this branch
-            if (not m_branchStopper(tipState)) {
-              // Remember the active tip and its state
-              result.activeTips.emplace_back(std::move(currentTip),
-                                             std::move(tipState));
-              // Record the number of branches on surface
-              nBranchesOnSurface++;
-            }
+              isOutlier, result, prevTip, prevTipState, neighborTip,
+              sharedTip, logger);
+          if (not isOutlier) {
+            measurementStates.push_back(
+                result.fittedStates->getTrackState(currentTip));
           }
+          addedStates.push_back(
+              {index, currentTip, std::move(tipState), isSourcelinkShared});
+          // Remember the tip of neighbor state on this surface
+          neighborTip = currentTip;
         }  // end of loop for all selected measurements on this surface
 
+        // Kalman update of all measurement track states on this surface
+        std::vector<std::error_code> updateStatuses;
+        if (not measurementStates.empty()) {
+          m_updater(state.geoContext, measurementStates, updateStatuses,
+                    forward, logger);
+        }
+
+        for (size_t i = 0; i < addedStates.size(); ++i) {
+          auto& added = addedStates[i];
+          // A failed update only drops this candidate. Its track state stays
+          // in the trajectory, but is not referenced by any branch.
+          if (not isOutlier and updateStatuses[i]) {
+            ACTS_ERROR("Update step failed: " << updateStatuses[i]);
+            continue;
+          }
+          // Remember the track state tip for this stored source link
+          if (not added.isSourcelinkShared) {
+            auto& sourcelinkTipsOnSurface = result.sourcelinkTips[surface];
+            sourcelinkTipsOnSurface.emplace(added.index, added.tip);
+          }
+
+          // Check if need to stop this branch
+          if (not m_branchStopper(added.tipState)) {
+            // Remember the active tip and its state
+            result.activeTips.emplace_back(added.tip,
+                                           std::move(added.tipState));
+            // Record the number of branches on surface
+            nBranchesOnSurface++;
+          }
+        }
+
         if (nBranchesOnSurface > 0 and not isOutlier) {
           // If there are measurement track states on this surface
           ACTS_VERBOSE("Filtering step successful with " << nBranchesOnSurface
                                                          << " branches");
           // Update stepping state using filtered parameters of last track
           // state on this surface
-          auto ts =
-              result.fittedStates.getTrackState(result.activeTips.back().first);
+          auto ts = result.fittedStates->getTrackState(
+              result.activeTips.back().first);
           stepper.update(state.stepping,
                          MultiTrajectoryHelpers::freeFiltered(
                              state.options.geoContext, ts),
@@ -737,29 +783,31 @@ class CombinatorialKalmanFilter {
     /// @param measurement The calibrated measurement to be stored
     /// @param isOutlier Indicator for outlier or not
     /// @param result is the mutable result state object
-    /// @param geoContext The geometry context (needed for Kalman update)
     /// @param neighborTip The neighbor state tip on this surface (the predicted
     /// parameters could be shared between neighbors)
     /// @param sharedTip The tip of state with shared source link
     /// @param logger The logger wrapper
     ///
     /// @return The tip of added state and its state
-    Result<std::pair<size_t, TipState>> addSourcelinkState(
+    ///
+    /// @note The Kalman update of a measurement state is left to the caller,
+    /// such that all states on a surface can be updated together.
+    std::pair<size_t, TipState> addSourcelinkState(
         const TrackStatePropMask& stateMask, const BoundState& boundState,
         const source_link_t& sourcelink,
         const BoundVariantMeasurement<source_link_t>& measurement,
-        bool isOutlier, result_type& result, const GeometryContext& geoContext,
-        const size_t& prevTip, const TipState& prevTipState,
+        bool isOutlier, result_type& result, const size_t& prevTip,
+        const TipState& prevTipState,
         size_t neighborTip = SIZE_MAX, size_t sharedTip = SIZE_MAX,
         LoggerWrapper logger = getDummyLogger()) const {
       // Inherit the tip state from the previous and will be updated later
       TipState tipState = prevTipState;
 
       // Add a track state
-      auto currentTip = result.fittedStates.addTrackState(stateMask, prevTip);
+      auto currentTip = result.fittedStates->addTrackState(stateMask, prevTip);
 
       // Get the track state proxy
-      auto trackStateProxy = result.fittedStates.getTrackState(currentTip);
+      auto trackStateProxy = result.fittedStates->getTrackState(currentTip);
 
       const auto& [boundParams, jacobian, pathLength] = boundState;
 
@@ -767,7 +815,7 @@ class CombinatorialKalmanFilter {
       if ((not ACTS_CHECK_BIT(stateMask, TrackStatePropMask::Predicted)) and
           neighborTip != SIZE_MAX) {
         // The predicted parameter is already stored, just set the index
-        auto neighborState = result.fittedStates.getTrackState(neighborTip);
+        auto neighborState = result.fittedStates->getTrackState(neighborTip);
         trackStateProxy.data().ipredicted = neighborState.data().ipredicted;
       } else {
         trackStateProxy.predicted() = boundParams.parameters();
@@ -778,7 +826,7 @@ class CombinatorialKalmanFilter {
 
       // Set the surface
       trackStateProxy.setReferenceSurface(
-          boundParams.referenceSurface().getSharedPtr());
+          boundParams.referenceSurface());
 
       // Assign the uncalibrated&calibrated measurement to the track
       // state (the uncalibrated could be already stored in other states)
@@ -786,7 +834,7 @@ class CombinatorialKalmanFilter {
           sharedTip != SIZE_MAX) {
         // The uncalibrated are already stored, just set the
         // index
-        auto shared = result.fittedStates.getTrackState(sharedTip);
+        auto shared = result.fittedStates->getTrackState(sharedTip);
         trackStateProxy.data().iuncalibrated = shared.data().iuncalibrated;
       } else {
         trackStateProxy.uncalibrated() = sourcelink;
@@ -817,12 +865,6 @@ class CombinatorialKalmanFilter {
         // parameter
         trackStateProxy.data().ifiltered = trackStateProxy.data().ipredicted;
       } else {
-        // Kalman update
-        auto updateRes = m_updater(geoContext, trackStateProxy);
-        if (!updateRes.ok()) {
-          ACTS_ERROR("Update step failed: " << updateRes.error());
-          return updateRes.error();
-        }
         ACTS_VERBOSE(
             "Creating measurement track state with tip = " << currentTip);
         // Set the measurement flag
@@ -848,11 +890,11 @@ class CombinatorialKalmanFilter {
                         size_t prevTip = SIZE_MAX,
                         LoggerWrapper logger = getDummyLogger()) const {
       // Add a track state
-      auto currentTip = result.fittedStates.addTrackState(stateMask, prevTip);
+      auto currentTip = result.fittedStates->addTrackState(stateMask, prevTip);
       ACTS_VERBOSE("Creating Hole track state with tip = " << currentTip);
 
       // now get track state proxy back
-      auto trackStateProxy = result.fittedStates.getTrackState(currentTip);
+      auto trackStateProxy = result.fittedStates->getTrackState(currentTip);
 
       // Set the track state flags
       auto& typeFlags = trackStateProxy.typeFlags();
@@ -868,7 +910,7 @@ class CombinatorialKalmanFilter {
       trackStateProxy.pathLength() = pathLength;
       // Set the surface
       trackStateProxy.setReferenceSurface(
-          boundParams.referenceSurface().getSharedPtr());
+          boundParams.referenceSurface());
       // Set the filtered parameter index to be the same with predicted
       // parameter
       trackStateProxy.data().ifiltered = trackStateProxy.data().ipredicted;
@@ -893,13 +935,13 @@ class CombinatorialKalmanFilter {
                            result_type& result, size_t prevTip = SIZE_MAX,
                            LoggerWrapper logger = getDummyLogger()) const {
       // Add a track state
-      auto currentTip = result.fittedStates.addTrackState(stateMask, prevTip);
+      auto currentTip = result.fittedStates->addTrackState(stateMask, prevTip);
       ACTS_VERBOSE(
           "Creating track state on in-sensitive material surface with tip = "
           << currentTip);
 
       // now get track state proxy back
-      auto trackStateProxy = result.fittedStates.getTrackState(currentTip);
+      auto trackStateProxy = result.fittedStates->getTrackState(currentTip);
 
       // Set the track state flags
       auto& typeFlags = trackStateProxy.typeFlags();
@@ -914,7 +956,7 @@ class CombinatorialKalmanFilter {
       trackStateProxy.pathLength() = pathLength;
       // Set the surface; reuse the existing curvilinear surface
       trackStateProxy.setReferenceSurface(
-          curvilinearParams.referenceSurface().getSharedPtr());
+          curvilinearParams.referenceSurface());
       // Set the filtered parameter index to be the same with predicted
       // parameter
       trackStateProxy.data().ifiltered = trackStateProxy.data().ipredicted;
@@ -996,7 +1038,7 @@ class CombinatorialKalmanFilter {
       std::vector<size_t> measurementIndices;
       // Count track states to be smoothed
       size_t nStates = 0;
-      result.fittedStates.applyBackwards(currentTip, [&](auto st) {
+      result.fittedStates->applyBackwards(currentTip, [&](auto st) {
         bool isMeasurement =
             st.typeFlags().test(TrackStateFlag::MeasurementFlag);
         if (isMeasurement) {
@@ -1021,7 +1063,7 @@ class CombinatorialKalmanFilter {
       ACTS_VERBOSE("Apply smoothing on " << nStates
                                          << " filtered track states.");
       // Smooth the track states
-      auto smoothRes = m_smoother(state.geoContext, result.fittedStates,
+      auto smoothRes = m_smoother(state.geoContext, *result.fittedStates,
                                   measurementIndices.front());
       if (!smoothRes.ok()) {
         ACTS_ERROR("Smoothing step failed: " << smoothRes.error());
@@ -1035,9 +1077,9 @@ class CombinatorialKalmanFilter {
 
       // Obtain the smoothed parameters at first/last measurement state
       auto firstCreatedMeasurement =
-          result.fittedStates.getTrackState(measurementIndices.back());
+          result.fittedStates->getTrackState(measurementIndices.back());
       auto lastCreatedMeasurement =
-          result.fittedStates.getTrackState(measurementIndices.front());
+          result.fittedStates->getTrackState(measurementIndices.front());
 
       // Lambda to get the intersection of the free params on the target surface
       auto target = [&](const FreeVector& freeVector) -> SurfaceIntersection {
@@ -1157,9 +1199,13 @@ class CombinatorialKalmanFilter {
   /// It's
   /// @c calibrator_t's job to turn them into calibrated measurements used in
   /// the track finding.
+  /// @note The source links are grouped by surface in a SourceLinkIndex. An
+  /// index can be passed directly as @p sourcelinks to avoid rebuilding it.
   ///
   /// @return a container of track finding result for all the initial track
   /// parameters
+  /// @note The track states of all initial track parameters are stored in a
+  /// single, shared multi trajectory.
   template <typename source_link_container_t,
             typename start_parameters_container_t, typename calibrator_t,
             typename measurement_selector_t,
@@ -1171,27 +1217,167 @@ class CombinatorialKalmanFilter {
              const CombinatorialKalmanFilterOptions<
                  calibrator_t, measurement_selector_t>& tfOptions) const {
     using SourceLink = typename source_link_container_t::value_type;
+    return findTracks<source_link_container_t, start_parameters_container_t,
+                      calibrator_t, measurement_selector_t, parameters_t>(
+        sourcelinks, initialParameters, tfOptions,
+        std::make_shared<MultiTrajectory<SourceLink>>());
+  }
+
+  /// Combinatorial track finding storing all tracks in a given trajectory.
+  ///
+  /// @param sourcelinks The fittable uncalibrated measurements
+  /// @param initialParameters The initial track parameters
+  /// @param tfOptions CombinatorialKalmanFilterOptions steering the track
+  /// finding
+  /// @param trajectory The multi trajectory to which the track states of all
+  /// initial track parameters are appended. It can be cleared and reused
+  /// between events to avoid reallocating its storage.
+  ///
+  /// @return a container of track finding result for all the initial track
+  /// parameters, all referring to @p trajectory
+  template <typename source_link_container_t,
+            typename start_parameters_container_t, typename calibrator_t,
+            typename measurement_selector_t,
+            typename parameters_t = BoundTrackParameters>
+  std::vector<Result<CombinatorialKalmanFilterResult<
+      typename source_link_container_t::value_type>>>
+  findTracks(const source_link_container_t& sourcelinks,
+             const start_parameters_container_t& initialParameters,
+             const CombinatorialKalmanFilterOptions<
+                 calibrator_t, measurement_selector_t>& tfOptions,
+             std::shared_ptr<
+                 MultiTrajectory<typename source_link_container_t::value_type>>
+                 trajectory) const {
+    using SourceLink = typename source_link_container_t::value_type;
     static_assert(SourceLinkConcept<SourceLink>,
                   "Source link does not fulfill SourceLinkConcept");
 
-    const auto& logger = tfOptions.logger;
+    return withMeasurementIndex(
+        sourcelinks, tfOptions, [&](const auto& inputMeasurements) {
+          auto propOptions = makePropagatorOptions<SourceLink, parameters_t>(
+              inputMeasurements, tfOptions, std::move(trajectory));
+
+          // Run the CombinatorialKalmanFilter.
+          // @todo The same target surface is used for all the initial track
+          // parameters, which is not necessarily the case.
+          std::vector<Result<CombinatorialKalmanFilterResult<SourceLink>>>
+              ckfResults;
+          ckfResults.reserve(initialParameters.size());
+          // Loop over all initial track parameters. Return the results for
+          // all initial track parameters including those failed ones.
+          for (size_t iseed = 0; iseed < initialParameters.size(); ++iseed) {
+            ckfResults.push_back(findTrack<SourceLink, parameters_t>(
+                initialParameters[iseed], iseed, propOptions,
+                tfOptions.logger));
+          }
+          return ckfResults;
+        });
+  }
 
-    // To be able to find measurements later, we put them into a map
-    // We need to copy input SourceLinks anyways, so the map can own them.
-    ACTS_VERBOSE("Preparing " << sourcelinks.size() << " input measurements");
-    std::unordered_map<GeometryIdentifier, std::vector<SourceLink>>
-        inputMeasurements;
-    for (const auto& sl : sourcelinks) {
-      inputMeasurements[sl.geometryId()].emplace_back(sl);
+  /// Combinatorial track finding with the seeds distributed by an executor.
+  ///
+  /// @param sourcelinks The fittable uncalibrated measurements
+  /// @param initialParameters The initial track parameters
+  /// @param tfOptions CombinatorialKalmanFilterOptions steering the track
+  /// finding
+  /// @param executor Distributes the seeds, see SequentialExecutor
+  ///
+  /// @note The propagator and the options are shared by all ranges and must
+  /// be safe to use concurrently.
+  ///
+  /// The seeds are handed to the executor as index ranges that may be
+  /// processed concurrently. The source link index is built once and shared
+  /// read-only by all ranges. Each range stores its tracks in its own multi
+  /// trajectory, i.e. the results of different ranges refer to different
+  /// trajectories.
+  ///
+  /// @return a container of track finding result for all the initial track
+  /// parameters in the order of the initial track parameters, independent of
+  /// the execution order
+  template <typename source_link_container_t,
+            typename start_parameters_container_t, typename calibrator_t,
+            typename measurement_selector_t, typename executor_t,
+            typename parameters_t = BoundTrackParameters,
+            typename = std::enable_if_t<std::is_invocable_v<
+                executor_t, size_t,
+                const std::function<void(size_t, size_t)>&>>>
+  std::vector<Result<CombinatorialKalmanFilterResult<
+      typename source_link_container_t::value_type>>>
+  findTracks(const source_link_container_t& sourcelinks,
+             const start_parameters_container_t& initialParameters,
+             const CombinatorialKalmanFilterOptions<
+                 calibrator_t, measurement_selector_t>& tfOptions,
+             executor_t&& executor) const {
+    using SourceLink = typename source_link_container_t::value_type;
+    using TrackFindingResult =
+        Result<CombinatorialKalmanFilterResult<SourceLink>>;
+    static_assert(SourceLinkConcept<SourceLink>,
+                  "Source link does not fulfill SourceLinkConcept");
+
+    // one output slot per seed keeps the result independent of the execution
+    // order and avoids any synchronisation between the tasks
+    std::vector<std::optional<TrackFindingResult>> slots(
+        initialParameters.size());
+    withMeasurementIndex(
+        sourcelinks, tfOptions, [&](const auto& inputMeasurements) {
+          executor(slots.size(), [&](size_t begin, size_t end) {
+            auto propOptions = makePropagatorOptions<SourceLink, parameters_t>(
+                inputMeasurements, tfOptions,
+                std::make_shared<MultiTrajectory<SourceLink>>());
+            for (size_t iseed = begin; iseed < end; ++iseed) {
+              slots[iseed].emplace(findTrack<SourceLink, parameters_t>(
+                  initialParameters[iseed], iseed, propOptions,
+                  tfOptions.logger));
+            }
+          });
+        });
+
+    std::vector<TrackFindingResult> ckfResults;
+    ckfResults.reserve(slots.size());
+    for (auto& slot : slots) {
+      assert(slot.has_value() and "Executor did not process all seeds");
+      ckfResults.push_back(std::move(*slot));
     }
+    return ckfResults;
+  }
 
+ private:
+  /// Call a function with the input measurements grouped by surface.
+  ///
+  /// A SourceLinkIndex is passed on as-is, any other container is copied into
+  /// a temporary index first.
+  template <typename source_link_container_t, typename options_t,
+            typename function_t>
+  static decltype(auto) withMeasurementIndex(
+      const source_link_container_t& sourcelinks, const options_t& tfOptions,
+      function_t&& function) {
+    using SourceLink = typename source_link_container_t::value_type;
+    if constexpr (std::is_same_v<source_link_container_t,
+                                 SourceLinkIndex<SourceLink>>) {
+      return function(sourcelinks);
+    } else {
+      const auto& logger = tfOptions.logger;
+      ACTS_VERBOSE("Preparing " << sourcelinks.size()
+                                << " input measurements");
+      return function(SourceLinkIndex<SourceLink>(sourcelinks));
+    }
+  }
+
+  /// Set up the propagator options with the track finding actor.
+  template <typename source_link_t, typename parameters_t,
+            typename calibrator_t, typename measurement_selector_t>
+  static auto makePropagatorOptions(
+      const SourceLinkIndex<source_link_t>& inputMeasurements,
+      const CombinatorialKalmanFilterOptions<
+          calibrator_t, measurement_selector_t>& tfOptions,
+      std::shared_ptr<MultiTrajectory<source_link_t>> trajectory) {
     // Create the ActionList and AbortList
     using CombinatorialKalmanFilterAborter =
-        Aborter<SourceLink, parameters_t, calibrator_t, measurement_selector_t>;
+        Aborter<source_link_t, parameters_t, calibrator_t,
+                measurement_selector_t>;
     using CombinatorialKalmanFilterActor =
-        Actor<SourceLink, parameters_t, calibrator_t, measurement_selector_t>;
-    using CombinatorialKalmanFilterResult =
-        typename CombinatorialKalmanFilterActor::result_type;
+        Actor<source_link_t, parameters_t, calibrator_t,
+              measurement_selector_t>;
     using Actors = ActionList<CombinatorialKalmanFilterActor>;
     using Aborters = AbortList<CombinatorialKalmanFilterAborter>;
 
@@ -1205,71 +1391,67 @@ class CombinatorialKalmanFilter {
     // Catch the actor and set the measurements
     auto& combKalmanActor =
         propOptions.actionList.template get<CombinatorialKalmanFilterActor>();
-    combKalmanActor.inputMeasurements = std::move(inputMeasurements);
+    combKalmanActor.inputMeasurements = &inputMeasurements;
     combKalmanActor.targetSurface = tfOptions.referenceSurface;
     combKalmanActor.multipleScattering = tfOptions.multipleScattering;
     combKalmanActor.energyLoss = tfOptions.energyLoss;
     combKalmanActor.smoothing = tfOptions.smoothing;
+    combKalmanActor.trajectory = std::move(trajectory);
 
     // copy calibrator and measurement selector
     combKalmanActor.m_calibrator = tfOptions.calibrator;
     combKalmanActor.m_measurementSelector = tfOptions.measurementSelector;
 
-    // Run the CombinatorialKalmanFilter.
-    // @todo The same target surface is used for all the initial track
-    // parameters, which is not necessarily the case.
-    std::vector<Result<CombinatorialKalmanFilterResult>> ckfResults;
-    ckfResults.reserve(initialParameters.size());
-    // Loop over all initial track parameters. Return the results for all
-    // initial track parameters including those failed ones.
-    for (size_t iseed = 0; iseed < initialParameters.size(); ++iseed) {
-      const auto& sParameters = initialParameters[iseed];
-      auto result = m_propagator.template propagate(sParameters, propOptions);
-
-      if (!result.ok()) {
-        ACTS_ERROR("Propapation failed: " << result.error()
-                                          << " with the initial parameters "
-                                          << iseed << " : \n"
-                                          << sParameters.parameters());
-        // Emplace back the failed result
-        ckfResults.emplace_back(result.error());
-        continue;
-      }
+    return propOptions;
+  }
 
-      const auto& propRes = *result;
-
-      /// Get the result of the CombinatorialKalmanFilter
-      auto combKalmanResult =
-          propRes.template get<CombinatorialKalmanFilterResult>();
-
-      /// The propagation could already reach max step size
-      /// before the track finding is finished during two phases:
-      // -> filtering for track finding;
-      // -> surface targeting to get fitted parameters at target surface.
-      // This is regarded as a failure.
-      // @TODO: Implement distinguishment between the above two cases if
-      // necessary
-      if (combKalmanResult.result.ok() and not combKalmanResult.finished) {
-        combKalmanResult.result = Result<void>(
-            CombinatorialKalmanFilterError::PropagationReachesMaxSteps);
-      }
+  /// Run the track finding for a single seed.
+  template <typename source_link_t, typename parameters_t,
+            typename start_parameters_t, typename propagator_options_t>
+  Result<CombinatorialKalmanFilterResult<source_link_t>> findTrack(
+      const start_parameters_t& sParameters, size_t iseed,
+      const propagator_options_t& propOptions, LoggerWrapper logger) const {
+    using CombinatorialKalmanFilterResult =
+        Acts::CombinatorialKalmanFilterResult<source_link_t>;
 
-      if (!combKalmanResult.result.ok()) {
-        ACTS_ERROR("CombinatorialKalmanFilter failed: "
-                   << combKalmanResult.result.error()
-                   << " with the initial parameters " << iseed << " : \n"
-                   << sParameters.parameters());
-        // Emplace back the failed result
-        ckfResults.emplace_back(combKalmanResult.result.error());
-        continue;
-      }
+    auto result = m_propagator.template propagate(sParameters, propOptions);
 
-      // Emplace back the successful result
-      ckfResults.emplace_back(combKalmanResult);
+    if (!result.ok()) {
+      ACTS_ERROR("Propapation failed: " << result.error()
+                                        << " with the initial parameters "
+                                        << iseed << " : \n"
+                                        << sParameters.parameters());
+      return result.error();
     }
-    return ckfResults;
-  }
 
+    auto& propRes = *result;
+
+    /// Get the result of the CombinatorialKalmanFilter
+    auto combKalmanResult =
+        std::move(propRes.template get<CombinatorialKalmanFilterResult>());
+
+    /// The propagation could already reach max step size
+    /// before the track finding is finished during two phases:
+    // -> filtering for track finding;
+    // -> surface targeting to get fitted parameters at target surface.
+    // This is regarded as a failure.
+    // @TODO: Implement distinguishment between the above two cases if
+    // necessary
+    if (combKalmanResult.result.ok() and not combKalmanResult.finished) {
+      combKalmanResult.result = Result<void>(
+          CombinatorialKalmanFilterError::PropagationReachesMaxSteps);
+    }
+
+    if (!combKalmanResult.result.ok()) {
+      ACTS_ERROR("CombinatorialKalmanFilter failed: "
+                 << combKalmanResult.result.error()
+                 << " with the initial parameters " << iseed << " : \n"
+                 << sParameters.parameters());
+      return combKalmanResult.result.error();
+    }
+
+    return combKalmanResult;
+  }
 };  // namespace Acts
 
 }  // namespace Acts
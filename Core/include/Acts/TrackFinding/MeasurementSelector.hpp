@@ -12,11 +12,14 @@
 #include "Acts/EventData/TrackParameters.hpp"
 #include "Acts/Geometry/GeometryHierarchyMap.hpp"
 #include "Acts/TrackFinding/CombinatorialKalmanFilterError.hpp"
+#include "Acts/TrackFitting/detail/SymmetricSystemBatch.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/Result.hpp"
 #include "Acts/Utilities/TypeTraits.hpp"
 
 #include <limits>
+#include <tuple>
+#include <type_traits>
 
 namespace Acts {
 
@@ -104,42 +107,74 @@ class MeasurementSelector {
         "Allowed maximum number of measurements: " << numMeasurementsCutOff);
 
     measChi2.resize(measurements.size());
-    double minChi2 = std::numeric_limits<double>::max();
-    size_t minIndex = 0;
-    size_t index = 0;
-    size_t nInitialCandidates = 0;
-    // Loop over all measurements to select the compatible measurements
-    for (const auto& measurement : measurements) {
+
+    // Evaluate the chi2 of all measurements in one batch and store it at the
+    // measurement index
+    auto evaluate = [&](auto& batch) {
+      if (batch.empty()) {
+        return;
+      }
+      batch.factorize();
+      for (size_t lane = 0; lane < batch.size(); ++lane) {
+        const size_t index = batch.id(lane);
+        // a residual covariance that is not positive definite never passes
+        const double chi2 = batch.valid(lane)
+                                ? batch.chi2(lane)
+                                : std::numeric_limits<double>::infinity();
+        measChi2[index] = {index, chi2};
+      }
+      batch.clear();
+    };
+
+    // Measurements of the same dimension are collected into batches such that
+    // the chi2 of many candidates is computed together. There is one batch per
+    // possible measurement dimension.
+    std::tuple<detail::SymmetricSystemBatch<1>, detail::SymmetricSystemBatch<2>,
+               detail::SymmetricSystemBatch<3>, detail::SymmetricSystemBatch<4>,
+               detail::SymmetricSystemBatch<5>, detail::SymmetricSystemBatch<6>>
+        batches;
+    static_assert(std::tuple_size_v<decltype(batches)> == eBoundSize,
+                  "Missing batch for some measurement dimensions");
+    // Take the parameter covariance
+    const auto& predictedCovariance = *predictedParams.covariance();
+    // Loop over all measurements to compute their chi2
+    for (size_t index = 0; index < measurements.size(); ++index) {
       std::visit(
           [&](const auto& meas) {
+            constexpr size_t kSize = std::decay_t<decltype(meas)>::size();
+            auto& batch = std::get<kSize - 1>(batches);
             // Take the projector (measurement mapping function)
-            const auto& H = meas.projector();
-            // Take the parameter covariance
-            const auto& predictedCovariance = *predictedParams.covariance();
-            // Get the residuals
-            const auto& res = meas.residuals(predictedParams.parameters());
-            // Get the chi2
-            double chi2 =
-                (res.transpose() *
-                 ((meas.covariance() + H * predictedCovariance * H.transpose()))
-                     .inverse() *
-                 res)
-                    .eval()(0, 0);
-
-            ACTS_VERBOSE("Chi2: " << chi2);
-            // Push the measurement index and chi2 if satisfying the criteria
-            if (chi2 < chi2CutOff) {
-              measChi2.at(nInitialCandidates) = {index, chi2};
-              nInitialCandidates++;
-            }
-            // Search for the measurement with the min chi2
-            if (chi2 < minChi2) {
-              minChi2 = chi2;
-              minIndex = index;
+            const auto H = meas.projector();
+            // The residuals and their covariance define the chi2
+            batch.push_back(
+                index, meas.residuals(predictedParams.parameters()),
+                meas.covariance() + H * predictedCovariance * H.transpose());
+            if (batch.full()) {
+              evaluate(batch);
             }
           },
-          measurement);
-      index++;
+          measurements[index]);
+    }
+    std::apply([&](auto&... batch) { (evaluate(batch), ...); }, batches);
+
+    // Select the compatible measurements in their original order, independent
+    // of the batches, such that ties in chi2 are resolved by index
+    double minChi2 = std::numeric_limits<double>::max();
+    size_t minIndex = 0;
+    size_t nInitialCandidates = 0;
+    for (size_t index = 0; index < measurements.size(); ++index) {
+      const double chi2 = measChi2[index].second;
+      ACTS_VERBOSE("Chi2: " << chi2);
+      // Push the measurement index and chi2 if satisfying the criteria
+      if (chi2 < chi2CutOff) {
+        measChi2[nInitialCandidates] = measChi2[index];
+        nInitialCandidates++;
+      }
+      // Search for the measurement with the min chi2
+      if (chi2 < minChi2) {
+        minChi2 = chi2;
+        minIndex = index;
+      }
     }
 
     // Get the number of measurement candidates with provided constraint
@@ -72,16 +72,24 @@ class GainMatrixSmoother {
       ACTS_VERBOSE("Filtered covariance:\n" << ts.filteredCovariance());
       ACTS_VERBOSE("Jacobian:\n" << ts.jacobian());
       ACTS_VERBOSE("Prev. predicted covariance\n"
-                   << prev_ts.predictedCovariance() << "\n, inverse: \n"
-                   << prev_ts.predictedCovariance().inverse());
+                   << prev_ts.predictedCovariance());
 
       // Gain smoothing matrix
       // NB: The jacobian stored in a state is the jacobian from previous
       // state to this state in forward propagation
-      BoundMatrix G = ts.filteredCovariance() * prev_ts.jacobian().transpose() *
-                      prev_ts.predictedCovariance().inverse();
-
-      if (G.hasNaN()) {
+      //
+      // G = C J^T P^-1 is computed as the solution of P G^T = J C with a
+      // pivoted LDL^T decomposition of the symmetric P instead of an explicit
+      // inverse. Parameters without any predicted variance, e.g. an unused
+      // time, then get a vanishing gain instead of failing the smoothing.
+      const BoundSymMatrix predictedCovariance = prev_ts.predictedCovariance();
+      const auto decomposition = predictedCovariance.ldlt();
+      BoundMatrix G =
+          decomposition
+              .solve(prev_ts.jacobian() * ts.filteredCovariance())
+              .transpose();
+
+      if (decomposition.info() != Eigen::Success or G.hasNaN()) {
         error = KalmanFitterError::SmoothFailed;  // set to error
         return false;                             // abort execution
       }
@@ -13,14 +13,39 @@
 #include "Acts/EventData/MultiTrajectory.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/TrackFitting/KalmanFitterError.hpp"
+#include "Acts/TrackFitting/detail/SymmetricSystemBatch.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/Result.hpp"
 
+#include <array>
+#include <system_error>
+#include <utility>
+#include <vector>
+
 namespace Acts {
 
 /// Kalman update step using the gain matrix formalism.
+///
+/// The update is computed in batches of track states with the same
+/// measurement dimension. The residual covariances of all states in a batch
+/// are factorized together in a structure-of-arrays layout, see
+/// `detail::SymmetricSystemBatch`, instead of being inverted one by one. A
+/// single track state is processed as a batch of one.
 class GainMatrixUpdater {
  public:
+  /// How the filtered covariance is computed from the gain matrix.
+  enum class CovarianceForm {
+    /// (1 - K H) P, the cheapest form.
+    Standard,
+    /// (1 - K H) P (1 - K H)^T + K V K^T, which remains symmetric and
+    /// positive semi-definite for ill-conditioned inputs.
+    Joseph,
+  };
+
+  GainMatrixUpdater() = default;
+  /// @param form How to compute the filtered covariance
+  explicit GainMatrixUpdater(CovarianceForm form) : m_form(form) {}
+
   /// Run the Kalman update step for a single trajectory state.
   ///
   /// @tparam source_link_t The type of source link
@@ -31,103 +56,249 @@ class GainMatrixUpdater {
   /// @param[in] logger Where to write logging information to
   template <typename source_link_t, size_t kMeasurementSizeMax>
   Result<void> operator()(
-      const GeometryContext& /*gctx*/,
+      const GeometryContext& gctx,
       detail_lt::TrackStateProxy<source_link_t, kMeasurementSizeMax, false>&
           trackState,
       const NavigationDirection& direction = forward,
       LoggerWrapper logger = getDummyLogger()) const {
-    ACTS_VERBOSE("Invoked GainMatrixUpdater");
-
-    // we should definitely have an uncalibrated measurement here
-    assert(trackState.hasUncalibrated());
-    // there should be a calibrated measurement
-    assert(trackState.hasCalibrated());
-    // we should have predicted state set
-    assert(trackState.hasPredicted());
-    // filtering should not have happened yet, but is allocated, therefore set
-    assert(trackState.hasFiltered());
-
-    // read-only handles. Types are eigen maps to backing storage
-    const auto predicted = trackState.predicted();
-    const auto predictedCovariance = trackState.predictedCovariance();
-
-    ACTS_VERBOSE("Predicted parameters: " << predicted.transpose());
-    ACTS_VERBOSE("Predicted covariance:\n" << predictedCovariance);
-
-    // read-write handles. Types are eigen maps into backing storage.
-    // This writes directly into the trajectory storage
-    auto filtered = trackState.filtered();
-    auto filteredCovariance = trackState.filteredCovariance();
-
-    // default-constructed error represents success, i.e. an invalid error code
-    std::error_code error;
-    visit_measurement(
-        trackState.calibrated(), trackState.calibratedCovariance(),
-        trackState.calibratedSize(),
-        [&](const auto calibrated, const auto calibratedCovariance) {
-          constexpr size_t kMeasurementSize =
-              decltype(calibrated)::RowsAtCompileTime;
-          using ParametersVector = ActsVector<kMeasurementSize>;
-          using CovarianceMatrix = ActsSymMatrix<kMeasurementSize>;
-
-          ACTS_VERBOSE("Measurement dimension: " << kMeasurementSize);
-          ACTS_VERBOSE("Calibrated measurement: " << calibrated.transpose());
-          ACTS_VERBOSE("Calibrated measurement covariance:\n"
-                       << calibratedCovariance);
-
-          const auto H =
-              trackState.projector()
-                  .template topLeftCorner<kMeasurementSize, eBoundSize>()
-                  .eval();
-
-          ACTS_VERBOSE("Measurement projector H:\n" << H);
-
-          const auto K =
-              (predictedCovariance * H.transpose() *
-               (H * predictedCovariance * H.transpose() + calibratedCovariance)
-                   .inverse())
-                  .eval();
-
-          ACTS_VERBOSE("Gain Matrix K:\n" << K);
-
-          if (K.hasNaN()) {
-            error =
-                (direction == forward)
-                    ? KalmanFitterError::ForwardUpdateFailed
-                    : KalmanFitterError::BackwardUpdateFailed;  // set to error
-            return false;  // abort execution
-          }
-
-          filtered = predicted + K * (calibrated - H * predicted);
-          filteredCovariance =
-              (BoundSymMatrix::Identity() - K * H) * predictedCovariance;
-          ACTS_VERBOSE("Filtered parameters: " << filtered.transpose());
-          ACTS_VERBOSE("Filtered covariance:\n" << filteredCovariance);
-
-          // calculate filtered residual
-          //
-          // FIXME: Without separate residual construction and assignment, we
-          //        currently take a +0.7GB build memory consumption hit in the
-          //        EventDataView unit tests. Revisit this once Measurement
-          //        overhead problems (Acts issue #350) are sorted out.
-          //
-          ParametersVector residual;
-          residual = calibrated - H * filtered;
-          ACTS_VERBOSE("Residual: " << residual.transpose());
-
-          trackState.chi2() =
-              (residual.transpose() *
-               ((CovarianceMatrix::Identity() - H * K) * calibratedCovariance)
-                   .inverse() *
-               residual)
-                  .value();
-
-          ACTS_VERBOSE("Chi2: " << trackState.chi2());
-          return true;  // continue execution
-        });
+    return (*this)(gctx, std::array{trackState}, direction, logger);
+  }
 
+  /// Run the Kalman update step for multiple trajectory states.
+  ///
+  /// @tparam track_state_range_t Random-access container of mutable track
+  ///   state proxies, e.g. a `std::vector` or `std::array`
+  /// @param[in] gctx The current geometry context object, e.g. alignment
+  /// @param[in] trackStates The track states, updated through the proxies
+  /// @param[in] direction The navigation direction
+  /// @param[in] logger Where to write logging information to
+  ///
+  /// The track states are independent, i.e. they can belong to different
+  /// tracks or be different measurement candidates for the same prediction.
+  /// A failing track state does not prevent the update of the others.
+  ///
+  /// @return The error of the first failing track state in container order
+  template <typename track_state_range_t>
+  Result<void> operator()(const GeometryContext& /*gctx*/,
+                          const track_state_range_t& trackStates,
+                          const NavigationDirection& direction = forward,
+                          LoggerWrapper logger = getDummyLogger()) const {
+    ACTS_VERBOSE("Invoked GainMatrixUpdater for " << trackStates.size()
+                                                   << " track states");
+
+    size_t firstFailure = trackStates.size();
+    std::error_code error;
+    updateAll(trackStates, direction, logger,
+              [&](size_t i, std::error_code status) {
+                if (i < firstFailure) {
+                  firstFailure = i;
+                  error = status;
+                }
+              },
+              std::make_index_sequence<eBoundSize>());
     return error ? Result<void>::failure(error) : Result<void>::success();
   }
+
+  /// Run the Kalman update step for multiple trajectory states and report
+  /// the outcome for each of them.
+  ///
+  /// @tparam track_state_range_t Random-access container of mutable track
+  ///   state proxies, e.g. a `std::vector` or `std::array`
+  /// @param[in] gctx The current geometry context object, e.g. alignment
+  /// @param[in] trackStates The track states, updated through the proxies
+  /// @param[out] statuses One entry per track state, set to the error of
+  ///   the corresponding update or cleared if it succeeded
+  /// @param[in] direction The navigation direction
+  /// @param[in] logger Where to write logging information to
+  template <typename track_state_range_t>
+  void operator()(const GeometryContext& /*gctx*/,
+                  const track_state_range_t& trackStates,
+                  std::vector<std::error_code>& statuses,
+                  const NavigationDirection& direction = forward,
+                  LoggerWrapper logger = getDummyLogger()) const {
+    ACTS_VERBOSE("Invoked GainMatrixUpdater for " << trackStates.size()
+                                                   << " track states");
+
+    statuses.assign(trackStates.size(), std::error_code());
+    updateAll(trackStates, direction, logger,
+              [&](size_t i, std::error_code status) { statuses[i] = status; },
+              std::make_index_sequence<eBoundSize>());
+  }
+
+ private:
+  /// Update the track states one measurement dimension after the other.
+  template <typename track_state_range_t, typename on_failure_t,
+            size_t... kIndices>
+  void updateAll(const track_state_range_t& trackStates,
+                 const NavigationDirection& direction, LoggerWrapper logger,
+                 on_failure_t&& onFailure,
+                 std::index_sequence<kIndices...> /*sizes*/) const {
+    (updateDimension<kIndices + 1>(trackStates, direction, logger, onFailure),
+     ...);
+  }
+
+  /// Collect all track states with the given measurement dimension in
+  /// batches and update them.
+  template <size_t kMeasurementSize, typename track_state_range_t,
+            typename on_failure_t>
+  void updateDimension(const track_state_range_t& trackStates,
+                       const NavigationDirection& direction,
+                       LoggerWrapper logger, on_failure_t& onFailure) const {
+    detail::SymmetricSystemBatch<kMeasurementSize> batch;
+
+    for (size_t i = 0; i < trackStates.size(); ++i) {
+      const auto& trackState = trackStates[i];
+      if (trackState.calibratedSize() != kMeasurementSize) {
+        continue;
+      }
+      // we should definitely have an uncalibrated measurement here
+      assert(trackState.hasUncalibrated());
+      // there should be a calibrated measurement
+      assert(trackState.hasCalibrated());
+      // we should have predicted state set
+      assert(trackState.hasPredicted());
+      // filtering should not have happened yet, but is allocated, therefore
+      // set
+      assert(trackState.hasFiltered());
+
+      const auto H =
+          trackState.projector()
+              .template topLeftCorner<kMeasurementSize, eBoundSize>()
+              .eval();
+      const auto predicted = trackState.predicted();
+      const auto predictedCovariance = trackState.predictedCovariance();
+      const auto calibrated =
+          trackState.calibrated().template head<kMeasurementSize>();
+      const auto calibratedCovariance =
+          trackState.calibratedCovariance()
+              .template topLeftCorner<kMeasurementSize, kMeasurementSize>();
+
+      // the residual and its covariance define the system to be solved
+      batch.push_back(
+          i, calibrated - H * predicted,
+          H * predictedCovariance * H.transpose() + calibratedCovariance);
+
+      if (batch.full()) {
+        updateBatch(batch, trackStates, direction, logger, onFailure);
+        batch.clear();
+      }
+    }
+    if (not batch.empty()) {
+      updateBatch(batch, trackStates, direction, logger, onFailure);
+    }
+  }
+
+  /// Compute gain, filtered state and chi2 for all track states in a batch.
+  ///
+  /// Track states with a singular residual covariance are reported through
+  /// @p onFailure and left untouched.
+  template <size_t kMeasurementSize, typename track_state_range_t,
+            typename on_failure_t>
+  void updateBatch(detail::SymmetricSystemBatch<kMeasurementSize>& batch,
+                   const track_state_range_t& trackStates,
+                   const NavigationDirection& direction, LoggerWrapper logger,
+                   on_failure_t& onFailure) const {
+    using Batch = detail::SymmetricSystemBatch<kMeasurementSize>;
+    using ProjectedCovariance = ActsMatrix<kMeasurementSize, eBoundSize>;
+
+    batch.factorize();
+
+    // With the residual covariance S, the gain matrix is
+    //
+    //     K = P H^T S^-1 = (S^-1 H P)^T
+    //
+    // i.e. each column of H P is solved for as an additional right-hand side.
+    std::array<ProjectedCovariance, Batch::capacity()> projectedCovariances;
+    std::array<typename Batch::LaneVector, eBoundSize> gainColumns{};
+    for (size_t lane = 0; lane < batch.size(); ++lane) {
+      const auto& trackState = trackStates[batch.id(lane)];
+      projectedCovariances[lane] =
+          trackState.projector()
+              .template topLeftCorner<kMeasurementSize, eBoundSize>() *
+          trackState.predictedCovariance();
+      for (size_t j = 0; j < eBoundSize; ++j) {
+        for (size_t i = 0; i < kMeasurementSize; ++i) {
+          gainColumns[j][i][lane] = projectedCovariances[lane](i, j);
+        }
+      }
+    }
+    for (auto& column : gainColumns) {
+      batch.solveInPlace(column);
+    }
+
+    for (size_t lane = 0; lane < batch.size(); ++lane) {
+      auto trackState = trackStates[batch.id(lane)];
+
+      ACTS_VERBOSE("Measurement dimension: " << kMeasurementSize);
+      ACTS_VERBOSE("Predicted parameters: "
+                   << trackState.predicted().transpose());
+      ACTS_VERBOSE("Predicted covariance:\n"
+                   << trackState.predictedCovariance());
+
+      ActsMatrix<eBoundSize, kMeasurementSize> K;
+      for (size_t j = 0; j < eBoundSize; ++j) {
+        for (size_t i = 0; i < kMeasurementSize; ++i) {
+          K(j, i) = gainColumns[j][i][lane];
+        }
+      }
+      ACTS_VERBOSE("Gain Matrix K:\n" << K);
+
+      // only a singular residual covariance is an error. an indefinite one,
+      // e.g. from a slightly non-positive predicted covariance, is tolerated
+      // as it was with the explicit inverse.
+      if (not batch.valid(lane) or K.hasNaN()) {
+        ACTS_VERBOSE("Residual covariance is singular");
+        onFailure(batch.id(lane),
+                  (direction == forward)
+                      ? KalmanFitterError::ForwardUpdateFailed
+                      : KalmanFitterError::BackwardUpdateFailed);
+        continue;
+      }
+
+      // K r = (H P)^T S^-1 r with the residual r
+      trackState.filtered() =
+          trackState.predicted() +
+          projectedCovariances[lane].transpose() * batch.solution(lane);
+      if (m_form == CovarianceForm::Joseph) {
+        const auto H =
+            trackState.projector()
+                .template topLeftCorner<kMeasurementSize, eBoundSize>()
+                .eval();
+        const auto calibratedCovariance =
+            trackState.calibratedCovariance()
+                .template topLeftCorner<kMeasurementSize, kMeasurementSize>();
+        const BoundMatrix reduction = BoundMatrix::Identity() - K * H;
+        trackState.filteredCovariance() =
+            reduction * trackState.predictedCovariance() *
+                reduction.transpose() +
+            K * calibratedCovariance * K.transpose();
+      } else {
+        trackState.filteredCovariance() =
+            trackState.predictedCovariance() - K * projectedCovariances[lane];
+      }
+      ACTS_VERBOSE("Filtered parameters: "
+                   << trackState.filtered().transpose());
+      ACTS_VERBOSE("Filtered covariance:\n"
+                   << trackState.filteredCovariance());
+
+      // The chi2 of the filtered residual with respect to its covariance
+      // (1 - H K) V equals the one of the predicted residual with respect to
+      // S, which is a by-product of the factorization.
+      trackState.chi2() = batch.chi2(lane);
+      ACTS_VERBOSE("Chi2: " << trackState.chi2());
+    }
+  }
+
+  CovarianceForm m_form = CovarianceForm::Standard;
+};
+
+/// Gain matrix updater that always uses the Joseph form covariance update.
+///
+/// The fitters default-construct their updater; this type allows to select
+/// the numerically more robust form through the updater template parameter.
+struct JosephFormGainMatrixUpdater : public GainMatrixUpdater {
+  JosephFormGainMatrixUpdater()
+      : GainMatrixUpdater(GainMatrixUpdater::CovarianceForm::Joseph) {}
 };
 
 }  // namespace Acts
@@ -16,6 +16,7 @@
 #include "Acts/EventData/MeasurementHelpers.hpp"
 #include "Acts/EventData/MultiTrajectory.hpp"
 #include "Acts/EventData/MultiTrajectoryHelpers.hpp"
+#include "Acts/EventData/SourceLinkIndex.hpp"
 #include "Acts/EventData/TrackParameters.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
@@ -35,7 +36,6 @@
 #include "Acts/Utilities/Result.hpp"
 
 #include <functional>
-#include <map>
 #include <memory>
 
 namespace Acts {
@@ -217,8 +217,9 @@ class KalmanFitter {
     /// The target surface
     const Surface* targetSurface = nullptr;
 
-    /// Allows retrieving measurements for a surface
-    std::map<GeometryIdentifier, source_link_t> inputMeasurements;
+    /// Allows retrieving measurements for a surface. Not owned, the index
+    /// must outlive the propagation.
+    const SourceLinkIndex<source_link_t>* inputMeasurements = nullptr;
 
     /// Whether to consider multiple scattering.
     bool multipleScattering = true;
@@ -252,11 +253,9 @@ class KalmanFitter {
       // We will try to hit those surface by ignoring boundary checks.
       if constexpr (not isDirectNavigator) {
         if (result.processedStates == 0) {
-          for (auto measurementIt = inputMeasurements.begin();
-               measurementIt != inputMeasurements.end(); measurementIt++) {
+          for (const auto& geoId : inputMeasurements->geometryIds()) {
             state.navigation.externalSurfaces.insert(
-                std::pair<uint64_t, GeometryIdentifier>(
-                    measurementIt->first.layer(), measurementIt->first));
+                std::pair<uint64_t, GeometryIdentifier>(geoId.layer(), geoId));
           }
         }
       }
@@ -318,7 +317,8 @@ class KalmanFitter {
       // reset navigation&stepping before run reversed filtering or
       // proceed to run smoothing
       if (not result.smoothed and not result.reversed) {
-        if (result.measurementStates == inputMeasurements.size() or
+        if (result.measurementStates ==
+                inputMeasurements->geometryIds().size() or
             (result.measurementStates > 0 and
              state.navigation.navigationBreak)) {
           if (reversedFiltering) {
@@ -471,8 +471,8 @@ class KalmanFitter {
                         const stepper_t& stepper, result_type& result) const {
       const auto& logger = state.options.logger;
       // Try to find the surface in the measurement surfaces
-      auto sourcelink_it = inputMeasurements.find(surface->geometryId());
-      if (sourcelink_it != inputMeasurements.end()) {
+      const auto sourcelinks = inputMeasurements->find(surface->geometryId());
+      if (not sourcelinks.empty()) {
         // Screen output message
         ACTS_VERBOSE("Measurement surface " << surface->geometryId()
                                             << " detected.");
@@ -496,10 +496,10 @@ class KalmanFitter {
         auto trackStateProxy =
             result.fittedStates.getTrackState(result.trackTip);
 
-        trackStateProxy.setReferenceSurface(surface->getSharedPtr());
+        trackStateProxy.setReferenceSurface(*surface);
 
         // assign the source link to the track state
-        trackStateProxy.uncalibrated() = sourcelink_it->second;
+        trackStateProxy.uncalibrated() = sourcelinks.front();
 
         // Fill the track state
         trackStateProxy.predicted() = std::move(boundParams.parameters());
@@ -576,7 +576,7 @@ class KalmanFitter {
               result.fittedStates.getTrackState(result.trackTip);
 
           // Set the surface
-          trackStateProxy.setReferenceSurface(surface->getSharedPtr());
+          trackStateProxy.setReferenceSurface(*surface);
 
           // Set the track state flags
           auto& typeFlags = trackStateProxy.typeFlags();
@@ -648,8 +648,8 @@ class KalmanFitter {
                                 result_type& result) const {
       const auto& logger = state.options.logger;
       // Try to find the surface in the measurement surfaces
-      auto sourcelink_it = inputMeasurements.find(surface->geometryId());
-      if (sourcelink_it != inputMeasurements.end()) {
+      const auto sourcelinks = inputMeasurements->find(surface->geometryId());
+      if (not sourcelinks.empty()) {
         // Screen output message
         ACTS_VERBOSE("Measurement surface "
                      << surface->geometryId()
@@ -679,10 +679,10 @@ class KalmanFitter {
         // Get the detached track state proxy back
         auto trackStateProxy = result.fittedStates.getTrackState(tempTrackTip);
 
-        trackStateProxy.setReferenceSurface(surface->getSharedPtr());
+        trackStateProxy.setReferenceSurface(*surface);
 
         // Assign the source link to the detached track state
-        trackStateProxy.uncalibrated() = sourcelink_it->second;
+        trackStateProxy.uncalibrated() = sourcelinks.front();
 
         // Fill the track state
         trackStateProxy.predicted() = std::move(boundParams.parameters());
@@ -1012,17 +1012,35 @@ class KalmanFitter {
       const -> std::enable_if_t<!isDirectNavigator,
                                 Result<KalmanFitterResult<source_link_t>>> {
     const auto& logger = kfOptions.logger;
-
-    static_assert(SourceLinkConcept<source_link_t>,
-                  "Source link does not fulfill SourceLinkConcept");
-
-    // To be able to find measurements later, we put them into a map
-    // We need to copy input SourceLinks anyways, so the map can own them.
     ACTS_VERBOSE("Preparing " << sourcelinks.size() << " input measurements");
-    std::map<GeometryIdentifier, source_link_t> inputMeasurements;
-    for (const auto& sl : sourcelinks) {
-      inputMeasurements.emplace(sl.geometryId(), sl);
-    }
+    return fit<source_link_t, start_parameters_t, calibrator_t,
+               outlier_finder_t, parameters_t>(
+        SourceLinkIndex<source_link_t>(sourcelinks), sParameters, kfOptions);
+  }
+
+  /// Fit implementation of the foward filter with prepared measurements
+  ///
+  /// @tparam source_link_t Type of the source link
+  /// @tparam start_parameters_t Type of the initial parameters
+  /// @tparam calibrator_t Type of the source link calibrator
+  /// @tparam outlier_finder_t Type of the outlier finder
+  /// @tparam parameters_t Type of parameters used for local parameters
+  ///
+  /// @param sourcelinks The fittable uncalibrated measurements grouped by
+  /// surface; only the first source link on each surface is used
+  /// @param sParameters The initial track parameters
+  /// @param kfOptions KalmanOptions steering the fit
+  ///
+  /// @return the output as an output track
+  template <typename source_link_t, typename start_parameters_t,
+            typename calibrator_t, typename outlier_finder_t,
+            typename parameters_t = BoundTrackParameters>
+  auto fit(const SourceLinkIndex<source_link_t>& sourcelinks,
+           const start_parameters_t& sParameters,
+           const KalmanFitterOptions<calibrator_t, outlier_finder_t>& kfOptions)
+      const -> std::enable_if_t<!isDirectNavigator,
+                                Result<KalmanFitterResult<source_link_t>>> {
+    const auto& logger = kfOptions.logger;
 
     // Create the ActionList and AbortList
     using KalmanAborter =
@@ -1042,7 +1060,7 @@ class KalmanFitter {
 
     // Catch the actor and set the measurements
     auto& kalmanActor = kalmanOptions.actionList.template get<KalmanActor>();
-    kalmanActor.inputMeasurements = std::move(inputMeasurements);
+    kalmanActor.inputMeasurements = &sourcelinks;
     kalmanActor.targetSurface = kfOptions.referenceSurface;
     kalmanActor.multipleScattering = kfOptions.multipleScattering;
     kalmanActor.energyLoss = kfOptions.energyLoss;
@@ -1107,16 +1125,38 @@ class KalmanFitter {
       -> std::enable_if_t<isDirectNavigator,
                           Result<KalmanFitterResult<source_link_t>>> {
     const auto& logger = kfOptions.logger;
-    static_assert(SourceLinkConcept<source_link_t>,
-                  "Source link does not fulfill SourceLinkConcept");
-
-    // To be able to find measurements later, we put them into a map
-    // We need to copy input SourceLinks anyways, so the map can own them.
     ACTS_VERBOSE("Preparing " << sourcelinks.size() << " input measurements");
-    std::map<GeometryIdentifier, source_link_t> inputMeasurements;
-    for (const auto& sl : sourcelinks) {
-      inputMeasurements.emplace(sl.geometryId(), sl);
-    }
+    return fit<source_link_t, start_parameters_t, calibrator_t,
+               outlier_finder_t, parameters_t>(
+        SourceLinkIndex<source_link_t>(sourcelinks), sParameters, kfOptions,
+        sSequence);
+  }
+
+  /// Fit implementation of the foward filter with prepared measurements
+  ///
+  /// @tparam source_link_t Type of the source link
+  /// @tparam start_parameters_t Type of the initial parameters
+  /// @tparam calibrator_t Type of the source link calibrator
+  /// @tparam outlier_finder_t Type of the outlier finder
+  /// @tparam parameters_t Type of parameters used for local parameters
+  ///
+  /// @param sourcelinks The fittable uncalibrated measurements grouped by
+  /// surface; only the first source link on each surface is used
+  /// @param sParameters The initial track parameters
+  /// @param kfOptions KalmanOptions steering the fit
+  /// @param sSequence surface sequence used to initialize a DirectNavigator
+  ///
+  /// @return the output as an output track
+  template <typename source_link_t, typename start_parameters_t,
+            typename calibrator_t, typename outlier_finder_t,
+            typename parameters_t = BoundTrackParameters>
+  auto fit(const SourceLinkIndex<source_link_t>& sourcelinks,
+           const start_parameters_t& sParameters,
+           const KalmanFitterOptions<calibrator_t, outlier_finder_t>& kfOptions,
+           const std::vector<const Surface*>& sSequence) const
+      -> std::enable_if_t<isDirectNavigator,
+                          Result<KalmanFitterResult<source_link_t>>> {
+    const auto& logger = kfOptions.logger;
 
     // Create the ActionList and AbortList
     using KalmanAborter =
@@ -1136,7 +1176,7 @@ class KalmanFitter {
 
     // Catch the actor and set the measurements
     auto& kalmanActor = kalmanOptions.actionList.template get<KalmanActor>();
-    kalmanActor.inputMeasurements = std::move(inputMeasurements);
+    kalmanActor.inputMeasurements = &sourcelinks;
     kalmanActor.targetSurface = kfOptions.referenceSurface;
     kalmanActor.multipleScattering = kfOptions.multipleScattering;
     kalmanActor.energyLoss = kfOptions.energyLoss;
@@ -76,9 +76,11 @@ globalTrackParametersCovariance(
     // beforehand smoothed states (indexed by j): C^n_{i-1, j}= G_{i-1} *
     // C^n_{i, j} for i <= j
     if (nProcessed > 0) {
-      // Calculate the gain matrix
-      GainMatrix G = ts.filteredCovariance() * prev_ts.jacobian().transpose() *
-                     prev_ts.predictedCovariance().inverse();
+      // Calculate the gain matrix, see GainMatrixSmoother
+      const CovMatrix predictedCovariance = prev_ts.predictedCovariance();
+      GainMatrix G = predictedCovariance.ldlt()
+                         .solve(prev_ts.jacobian() * ts.filteredCovariance())
+                         .transpose();
       // Loop over the beforehand smoothed states
       for (size_t iProcessed = 1; iProcessed <= nProcessed; iProcessed++) {
         const size_t iCol = iRow + eBoundSize * iProcessed;
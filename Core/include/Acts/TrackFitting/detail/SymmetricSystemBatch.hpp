@@ -0,0 +1,204 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+
+namespace Acts {
+namespace detail {
+
+/// Fixed-width batch of small symmetric linear systems.
+///
+/// Holds up to `kWidth` systems `S x = b` of dimension `kSize` in a
+/// structure-of-arrays layout, i.e. every element of the lower triangle of
+/// `S` and of `b` is stored as an array over the lanes. The LDL^T
+/// factorization and the substitutions loop over the lanes innermost with a
+/// compile-time trip count, which the compiler is able to vectorize. Unused
+/// lanes hold the identity and need no masking.
+///
+/// The batch lives on the stack and never allocates.
+///
+/// @tparam kSize Dimension of the systems
+/// @tparam kWidth Number of lanes
+template <size_t kSize, size_t kWidth = 8>
+class SymmetricSystemBatch {
+ public:
+  using Scalar = ActsScalar;
+  using Lanes = std::array<Scalar, kWidth>;
+  /// One vector of dimension `kSize` for all lanes.
+  using LaneVector = std::array<Lanes, kSize>;
+
+  SymmetricSystemBatch() { clear(); }
+
+  /// Maximum number of systems.
+  static constexpr size_t capacity() { return kWidth; }
+  /// Number of stored systems.
+  size_t size() const { return m_size; }
+  bool empty() const { return m_size == 0; }
+  bool full() const { return m_size == kWidth; }
+
+  /// Remove all systems and reset all lanes to the identity.
+  void clear() {
+    m_size = 0;
+    for (size_t i = 0; i < kSize; ++i) {
+      for (size_t j = 0; j <= i; ++j) {
+        m_lower[index(i, j)].fill(i == j ? 1 : 0);
+      }
+      m_rhs[i].fill(0);
+    }
+    m_chi2.fill(0);
+    m_minPivot.fill(1);
+  }
+
+  /// Add a system to the next free lane.
+  ///
+  /// @param id Caller-defined identifier, e.g. an index into the input
+  /// @param rhs Right-hand side `b`
+  /// @param matrix Symmetric matrix `S`, only the lower triangle is read
+  /// @return The lane of the added system
+  template <typename vector_t, typename matrix_t>
+  size_t push_back(size_t id, const Eigen::MatrixBase<vector_t>& rhs,
+                   const Eigen::MatrixBase<matrix_t>& matrix) {
+    assert(not full() and "Symmetric system batch is full");
+    const size_t lane = m_size++;
+    m_ids[lane] = id;
+    for (size_t i = 0; i < kSize; ++i) {
+      m_rhs[i][lane] = rhs(i);
+      for (size_t j = 0; j <= i; ++j) {
+        m_lower[index(i, j)][lane] = matrix(i, j);
+      }
+    }
+    return lane;
+  }
+
+  /// Factorize all lanes in place and solve for the stored right-hand sides.
+  ///
+  /// Afterwards chi2() returns `b^T S^-1 b` and solution() returns `S^-1 b`.
+  void factorize() {
+    // S = L D L^T with unit lower triangular L; D is stored on the diagonal
+    for (size_t j = 0; j < kSize; ++j) {
+      Lanes& djj = m_lower[index(j, j)];
+      for (size_t k = 0; k < j; ++k) {
+        const Lanes& ljk = m_lower[index(j, k)];
+        const Lanes& dkk = m_lower[index(k, k)];
+        for (size_t l = 0; l < kWidth; ++l) {
+          djj[l] -= ljk[l] * ljk[l] * dkk[l];
+        }
+      }
+      // written such that a NaN pivot also marks the lane as invalid
+      for (size_t l = 0; l < kWidth; ++l) {
+        const Scalar pivot = std::abs(djj[l]);
+        m_minPivot[l] = std::min(m_minPivot[l], (0 < pivot) ? pivot : 0);
+      }
+      for (size_t i = j + 1; i < kSize; ++i) {
+        Lanes& lij = m_lower[index(i, j)];
+        for (size_t k = 0; k < j; ++k) {
+          const Lanes& lik = m_lower[index(i, k)];
+          const Lanes& ljk = m_lower[index(j, k)];
+          const Lanes& dkk = m_lower[index(k, k)];
+          for (size_t l = 0; l < kWidth; ++l) {
+            lij[l] -= lik[l] * ljk[l] * dkk[l];
+          }
+        }
+        for (size_t l = 0; l < kWidth; ++l) {
+          lij[l] /= djj[l];
+        }
+      }
+    }
+    // the chi2 is accumulated between the forward and backward substitution
+    forwardSubstitute(m_rhs);
+    m_chi2.fill(0);
+    for (size_t i = 0; i < kSize; ++i) {
+      const Lanes& dii = m_lower[index(i, i)];
+      for (size_t l = 0; l < kWidth; ++l) {
+        m_chi2[l] += m_rhs[i][l] * m_rhs[i][l] / dii[l];
+      }
+    }
+    backwardSubstitute(m_rhs);
+  }
+
+  /// Solve for an additional right-hand side in place.
+  ///
+  /// @param rhs Right-hand side for all lanes, overwritten with `S^-1 rhs`
+  /// @note Requires a previous call to factorize().
+  void solveInPlace(LaneVector& rhs) const {
+    forwardSubstitute(rhs);
+    backwardSubstitute(rhs);
+  }
+
+  /// Identifier of the system in the given lane.
+  size_t id(size_t lane) const { return m_ids[lane]; }
+  /// Whether the system in the given lane could be solved.
+  ///
+  /// The factorization does not pivot, i.e. it fails for singular systems and
+  /// for some indefinite ones. Positive-definite systems are always solved.
+  bool valid(size_t lane) const { return m_minPivot[lane] > 0; }
+  /// Value of `b^T S^-1 b` in the given lane.
+  Scalar chi2(size_t lane) const { return m_chi2[lane]; }
+  /// Solution `S^-1 b` in the given lane.
+  ActsVector<kSize> solution(size_t lane) const {
+    ActsVector<kSize> x;
+    for (size_t i = 0; i < kSize; ++i) {
+      x(i) = m_rhs[i][lane];
+    }
+    return x;
+  }
+
+ private:
+  static constexpr size_t kNumElements = kSize * (kSize + 1) / 2;
+
+  /// Packed index of the lower triangle element (i, j) with i >= j.
+  static constexpr size_t index(size_t i, size_t j) {
+    return i * (i + 1) / 2 + j;
+  }
+
+  /// Overwrite rhs with L^-1 rhs.
+  void forwardSubstitute(LaneVector& rhs) const {
+    for (size_t i = 1; i < kSize; ++i) {
+      for (size_t k = 0; k < i; ++k) {
+        const Lanes& lik = m_lower[index(i, k)];
+        for (size_t l = 0; l < kWidth; ++l) {
+          rhs[i][l] -= lik[l] * rhs[k][l];
+        }
+      }
+    }
+  }
+
+  /// Overwrite the forward substituted rhs with L^-T D^-1 rhs.
+  void backwardSubstitute(LaneVector& rhs) const {
+    for (size_t i = kSize; 0 < i--;) {
+      const Lanes& dii = m_lower[index(i, i)];
+      for (size_t l = 0; l < kWidth; ++l) {
+        rhs[i][l] /= dii[l];
+      }
+      for (size_t k = i + 1; k < kSize; ++k) {
+        const Lanes& lki = m_lower[index(k, i)];
+        for (size_t l = 0; l < kWidth; ++l) {
+          rhs[i][l] -= lki[l] * rhs[k][l];
+        }
+      }
+    }
+  }
+
+  std::array<Lanes, kNumElements> m_lower;
+  LaneVector m_rhs;
+  Lanes m_chi2;
+  Lanes m_minPivot;
+  std::array<size_t, kWidth> m_ids;
+  size_t m_size = 0;
+};
+
+}  // namespace detail
+}  // namespace Acts
@@ -0,0 +1,228 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+#include "Acts/Utilities/BinUtility.hpp"
+#include "Acts/Utilities/BinnedArray.hpp"
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace Acts {
+
+/// @class BinnedArrayFlat
+///
+/// BinnedArray with the objects stored in one contiguous, row-major vector,
+/// i.e. the first bin index runs fastest. The dimension of the binning is a
+/// template parameter, such that a lookup only evaluates the bins of the
+/// given dimensions and reads a single pointer from the store.
+///
+/// It is a drop-in replacement for a 1D, 2D or 3D BinnedArrayXD. The nested
+/// object grid of the BinnedArray interface is not used for the lookup and
+/// only built on the first call to `objectGrid()`, which then doubles the
+/// memory held by the array.
+///
+/// @tparam T the object type, has to be of pointer type
+/// @tparam DIM the number of binning dimensions, 1, 2 or 3
+template <class T, size_t DIM>
+class BinnedArrayFlat final : public BinnedArray<T> {
+  static_assert(DIM >= 1 and DIM <= 3,
+                "BinnedArrayFlat supports 1 to 3 dimensions");
+
+  /// typedef the object and position for readability
+  using TAP = std::pair<T, Vector3>;
+
+ public:
+  /// Constructor with std::vector and a BinUtility
+  ///
+  /// @param tapvector is a vector of object and binning position
+  /// @param bu is the unique bin utility for this binned array
+  BinnedArrayFlat(const std::vector<TAP>& tapvector,
+                  std::unique_ptr<const BinUtility> bu)
+      : BinnedArray<T>(), m_binUtility(std::move(bu)) {
+    initialize();
+    m_arrayObjects.reserve(tapvector.size());
+    for (auto& tap : tapvector) {
+      if (m_binUtility->inside(tap.second)) {
+        auto bins = m_binUtility->binTriple(tap.second);
+        m_objects[storeIndex(bins)] = tap.first;
+        addArrayObject(tap.first);
+      }
+    }
+  }
+
+  /// Constructor with a grid and a BinUtility
+  ///
+  /// @param grid is the prepared object grid, indexed as [bin2][bin1][bin0]
+  /// @param bu is the unique bin utility for this binned array
+  BinnedArrayFlat(const std::vector<std::vector<std::vector<T>>>& grid,
+                  std::unique_ptr<const BinUtility> bu)
+      : BinnedArray<T>(), m_binUtility(std::move(bu)) {
+    initialize();
+    m_arrayObjects.reserve(m_objects.size());
+    for (size_t i2 = 0; i2 < grid.size(); ++i2) {
+      for (size_t i1 = 0; i1 < grid[i2].size(); ++i1) {
+        for (size_t i0 = 0; i0 < grid[i2][i1].size(); ++i0) {
+          const T& object = grid[i2][i1][i0];
+          m_objects.at(storeIndex({{i0, i1, i2}})) = object;
+          if (object) {
+            addArrayObject(object);
+          }
+        }
+      }
+    }
+  }
+
+  /// Copy constructor
+  /// - not allowed, use the same array
+  BinnedArrayFlat(const BinnedArrayFlat<T, DIM>& barr) = delete;
+
+  /// Assignment operator
+  /// - not allowed, use the same array
+  BinnedArrayFlat& operator=(const BinnedArrayFlat<T, DIM>& barr) = delete;
+
+  /// Destructor
+  ~BinnedArrayFlat() override = default;
+
+  /// Returns the object in the array from a local position
+  ///
+  /// @param lposition is the local position for the bin search
+  /// @param bins is the bin triple filled during this access
+  ///
+  /// @return is the object in that bin
+  T object(const Vector2& lposition,
+           std::array<size_t, 3>& bins) const override {
+    return lookup(lposition, bins);
+  }
+
+  // satisfy overload / override
+  T object(const Vector2& lposition) const override {
+    std::array<size_t, 3> bins;
+    return lookup(lposition, bins);
+  }
+
+  /// Returns the object in the array from a global position
+  ///
+  /// @param position is the global position for the bin search
+  /// @param bins is the bins triple filled during access
+  ///
+  /// @return is the object in that bin
+  T object(const Vector3& position,
+           std::array<size_t, 3>& bins) const override {
+    return lookup(position, bins);
+  }
+
+  // satisfy overload / override
+  T object(const Vector3& position) const override {
+    std::array<size_t, 3> bins;
+    return lookup(position, bins);
+  }
+
+  /// Return all unqiue object
+  /// @return vector of unique array objects
+  const std::vector<T>& arrayObjects() const override {
+    return m_arrayObjects;
+  }
+
+  /// Return the object grid
+  /// multiple entries are allowed and wanted
+  /// @return object grid in the nested layout of the BinnedArray interface
+  /// @note The grid is built from the flat store on the first call
+  const std::vector<std::vector<std::vector<T>>>& objectGrid()
+      const override {
+    std::call_once(m_objectGridOnce, [this]() { fillObjectGrid(); });
+    return m_objectGrid;
+  }
+
+  /// Return the BinUtility
+  /// @return plain pointer to the bin utility of this array
+  const BinUtility* binUtility() const override { return m_binUtility.get(); }
+
+ private:
+  /// Check the dimensions and allocate the store
+  void initialize() {
+    if (not m_binUtility or m_binUtility->dimensions() != DIM) {
+      throw std::invalid_argument(
+          "BinnedArrayFlat: bin utility does not match the dimension");
+    }
+    m_strides = {{1, m_binUtility->bins(0),
+                  m_binUtility->bins(0) * m_binUtility->bins(1)}};
+    m_objects.assign(m_strides[2] * m_binUtility->bins(2), nullptr);
+  }
+
+  /// Add an object to the unique array objects
+  void addArrayObject(const T& object) {
+    if (std::find(m_arrayObjects.begin(), m_arrayObjects.end(), object) ==
+        m_arrayObjects.end()) {
+      m_arrayObjects.push_back(object);
+    }
+  }
+
+  /// Mirror the store into the nested object grid
+  void fillObjectGrid() const {
+    m_objectGrid.assign(
+        m_binUtility->bins(2),
+        std::vector<std::vector<T>>(m_binUtility->bins(1),
+                                    std::vector<T>(m_binUtility->bins(0))));
+    for (size_t i2 = 0; i2 < m_objectGrid.size(); ++i2) {
+      for (size_t i1 = 0; i1 < m_objectGrid[i2].size(); ++i1) {
+        for (size_t i0 = 0; i0 < m_objectGrid[i2][i1].size(); ++i0) {
+          m_objectGrid[i2][i1][i0] = m_objects[storeIndex({{i0, i1, i2}})];
+        }
+      }
+    }
+  }
+
+  /// Position of a bin triple in the store
+  size_t storeIndex(const std::array<size_t, 3>& bins) const {
+    size_t index = bins[0];
+    if constexpr (DIM > 1) {
+      index += m_strides[1] * bins[1];
+    }
+    if constexpr (DIM > 2) {
+      index += m_strides[2] * bins[2];
+    }
+    return index;
+  }
+
+  /// Lookup for local positions
+  T lookup(const Vector2& lposition, std::array<size_t, 3>& bins) const {
+    bins[0] = m_binUtility->bin(lposition, 0);
+    bins[1] = DIM > 1 ? m_binUtility->bin(lposition, 1) : 0;
+    bins[2] = DIM > 2 ? m_binUtility->bin(lposition, 2) : 0;
+    return m_objects[storeIndex(bins)];
+  }
+
+  /// Lookup for global positions, transformed only once
+  T lookup(const Vector3& position, std::array<size_t, 3>& bins) const {
+    if constexpr (DIM == 1) {
+      bins = {{m_binUtility->bin(position, 0), 0, 0}};
+    } else {
+      bins = m_binUtility->binTriple(position);
+    }
+    return m_objects[storeIndex(bins)];
+  }
+
+  /// the data store, row-major with the first bin running fastest
+  std::vector<T> m_objects;
+  /// strides of the bin indices in the store
+  std::array<size_t, 3> m_strides = {{1, 0, 0}};
+  /// the nested object grid of the BinnedArray interface, built on demand
+  mutable std::vector<std::vector<std::vector<T>>> m_objectGrid;
+  mutable std::once_flag m_objectGridOnce;
+  /// Vector of unique Array objects
+  std::vector<T> m_arrayObjects;
+  /// binUtility for retrieving and filling the Array
+  std::unique_ptr<const BinUtility> m_binUtility;
+};
+
+}  // namespace Acts
@@ -0,0 +1,36 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace Acts {
+
+/// Executor that runs all work items on the calling thread.
+///
+/// Algorithms that can distribute independent work items accept an executor,
+/// i.e. a callable with the signature
+///
+///     void(size_t nItems, const std::function<void(size_t, size_t)>& task)
+///
+/// that must call `task(begin, end)` for disjoint index ranges that together
+/// cover `[0, nItems)`. The ranges may be processed concurrently and in any
+/// order, e.g. by wrapping `tbb::parallel_for`. This keeps the core library
+/// free of a specific threading library.
+struct SequentialExecutor {
+  void operator()(size_t nItems,
+                  const std::function<void(size_t, size_t)>& task) const {
+    if (nItems > 0) {
+      task(0, nItems);
+    }
+  }
+};
+
+}  // namespace Acts
@@ -13,9 +13,9 @@
 #include "Acts/Utilities/detail/Axis.hpp"
 
 #include <array>
-#include <set>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 namespace Acts {
 
@@ -85,7 +85,7 @@ class GlobalNeighborHoodIndices {
       return *this;
     }
 
-    bool operator==(const iterator& it) {
+    bool operator==(const iterator& it) const {
       // We know when we've reached the end, so we don't need an end-iterator.
       // Sadly, in C++, there has to be one. Therefore, we special-case it
       // heavily so that it's super-efficient to create and compare to.
@@ -96,7 +96,7 @@ class GlobalNeighborHoodIndices {
       }
     }
 
-    bool operator!=(const iterator& it) { return !(*this == it); }
+    bool operator!=(const iterator& it) const { return !(*this == it); }
 
    private:
     std::array<NeighborHoodIndices::iterator, DIM> m_localIndicesIter;
@@ -281,7 +281,7 @@ struct grid_helper_impl {
   template <class... Axes>
   static void exteriorBinIndices(std::array<size_t, sizeof...(Axes)>& idx,
                                  std::array<bool, sizeof...(Axes)> isExterior,
-                                 std::set<size_t>& combinations,
+                                 std::vector<size_t>& combinations,
                                  const std::tuple<Axes...>& axes) {
     // iterate over this axis' bins, remembering which bins are exterior
     for (size_t i = 0; i < std::get<N>(axes).getNBins() + 2; ++i) {
@@ -410,7 +410,7 @@ struct grid_helper_impl<0u> {
   template <class... Axes>
   static void exteriorBinIndices(std::array<size_t, sizeof...(Axes)>& idx,
                                  std::array<bool, sizeof...(Axes)> isExterior,
-                                 std::set<size_t>& combinations,
+                                 std::vector<size_t>& combinations,
                                  const std::tuple<Axes...>& axes) {
     // For each exterior bin on this axis, we will do this
     auto recordExteriorBin = [&](size_t i) {
@@ -418,7 +418,7 @@ struct grid_helper_impl<0u> {
       // at this point, combinations are complete: save the global bin
       size_t bin = 0, area = 1;
       grid_helper_impl<sizeof...(Axes) - 1>::getGlobalBin(idx, axes, bin, area);
-      combinations.insert(bin);
+      combinations.push_back(bin);
     };
 
     // The first and last bins on this axis are exterior by definition
@@ -762,14 +762,16 @@ struct grid_helper {
   ///
   /// @tparam Axes parameter pack of axis types defining the grid
   /// @param  [in] axes         actual axis objects spanning the grid
-  /// @return set of global bin indices for all over- and underflow bins
+  /// @return global bin indices of all over- and underflow bins, each once
   template <class... Axes>
-  static std::set<size_t> exteriorBinIndices(const std::tuple<Axes...>& axes) {
+  static std::vector<size_t> exteriorBinIndices(
+      const std::tuple<Axes...>& axes) {
     constexpr size_t MAX = sizeof...(Axes) - 1;
 
     std::array<size_t, sizeof...(Axes)> idx;
     std::array<bool, sizeof...(Axes)> isExterior;
-    std::set<size_t> combinations;
+    // every combination is visited once, no need for a set
+    std::vector<size_t> combinations;
     grid_helper_impl<MAX>::exteriorBinIndices(idx, isExterior, combinations,
                                               axes);
 
@@ -28,7 +28,7 @@
 #include "Acts/Surfaces/SurfaceArray.hpp"
 #include "Acts/Utilities/BinUtility.hpp"
 #include "Acts/Utilities/BinnedArray.hpp"
-#include "Acts/Utilities/BinnedArrayXD.hpp"
+#include "Acts/Utilities/BinnedArrayFlat.hpp"
 #include "Acts/Utilities/BinningData.hpp"
 #include "Acts/Utilities/Logger.hpp"
 
@@ -223,7 +223,7 @@ Acts::MutableTrackingVolumePtr Acts::CuboidVolumeBuilder::trackingVolume(
 
   // Build TrackingVolume array
   std::shared_ptr<const TrackingVolumeArray> trVolArr(
-      new BinnedArrayXD<TrackingVolumePtr>(tapVec, std::move(bu)));
+      new BinnedArrayFlat<TrackingVolumePtr, 1>(tapVec, std::move(bu)));
 
   // Create world volume
   MutableTrackingVolumePtr mtvp(
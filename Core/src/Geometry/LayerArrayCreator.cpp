@@ -19,7 +19,7 @@
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Surfaces/SurfaceBounds.hpp"
 #include "Acts/Utilities/BinUtility.hpp"
-#include "Acts/Utilities/BinnedArrayXD.hpp"
+#include "Acts/Utilities/BinnedArrayFlat.hpp"
 #include "Acts/Utilities/BinningType.hpp"
 
 #include <algorithm>
@@ -165,8 +165,8 @@ std::unique_ptr<const Acts::LayerArray> Acts::LayerArrayCreator::layerArray(
     }
   }
   // return the binned array
-  return std::make_unique<const BinnedArrayXD<LayerPtr>>(layerOrderVector,
-                                                         std::move(binUtility));
+  return std::make_unique<const BinnedArrayFlat<LayerPtr, 1>>(
+      layerOrderVector, std::move(binUtility));
 }
 
 std::shared_ptr<Acts::Surface> Acts::LayerArrayCreator::createNavigationSurface(
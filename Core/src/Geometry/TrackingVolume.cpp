@@ -428,6 +428,8 @@ void Acts::TrackingVolume::closeGeometry(
         }
       }
     }
+    // the layers and boundaries are final now
+    m_extentPrune = VolumeExtentPrune::create(*this);
   } else {
     // B) this is a container volume, go through sub volume
     // do the loop
@@ -478,10 +480,21 @@ Acts::TrackingVolume::compatibleBoundaries(
     const GeometryContext& gctx, const Vector3& position,
     const Vector3& direction, const NavigationOptions<Surface>& options,
     LoggerWrapper logger) const {
+  std::vector<BoundaryIntersection> bIntersections;
+  compatibleBoundaries(gctx, position, direction, options, bIntersections,
+                       logger);
+  return bIntersections;
+}
+
+void Acts::TrackingVolume::compatibleBoundaries(
+    const GeometryContext& gctx, const Vector3& position,
+    const Vector3& direction, const NavigationOptions<Surface>& options,
+    std::vector<BoundaryIntersection>& bIntersections,
+    LoggerWrapper logger) const {
   ACTS_VERBOSE("Finding compatibleBoundaries");
   // Loop over boundarySurfaces and calculate the intersection
   auto excludeObject = options.startObject;
-  std::vector<BoundaryIntersection> bIntersections;
+  bIntersections.clear();
 
   // The signed direction: solution (except overstepping) is positive
   auto sDirection = options.navDir * direction;
@@ -490,6 +503,10 @@ Acts::TrackingVolume::compatibleBoundaries(
   double pLimit = options.pathLimit;
   double oLimit = options.overstepLimit;
 
+  // The region covered by the straight line within the limits
+  VolumeExtentPrune::LineWindow window(position, sDirection,
+                                      std::min(oLimit, 0.), std::abs(pLimit));
+
   // Helper function to test intersection
   auto checkIntersection =
       [&](SurfaceIntersection& sIntersection,
@@ -546,11 +563,13 @@ Acts::TrackingVolume::compatibleBoundaries(
   };
 
   /// Helper function to process boundary surfaces
-  auto processBoundaries =
-      [&](const TrackingVolumeBoundaries& bSurfaces) -> void {
+  /// @param prune the r/z prune of the boundaries, can be nullptr
+  auto processBoundaries = [&](const TrackingVolumeBoundaries& bSurfaces,
+                               const VolumeExtentPrune* prune) -> void {
     ACTS_VERBOSE("Processing boundaries");
     // Loop over the boundary surfaces
-    for (auto& bsIter : bSurfaces) {
+    for (size_t ib = 0; ib < bSurfaces.size(); ++ib) {
+      const auto& bsIter = bSurfaces[ib];
       // Get the boundary surface pointer
       const auto& bSurfaceRep = bsIter->surfaceRepresentation();
       if (logger().doPrint(Logging::VERBOSE)) {
@@ -561,8 +580,13 @@ Acts::TrackingVolume::compatibleBoundaries(
         os << strm.str();
       }
 
-      // Exclude the boundary where you are on
-      if (excludeObject != &bSurfaceRep) {
+      // Exclude the boundary where you are on or that can not be reached
+      if (excludeObject == &bSurfaceRep) {
+        ACTS_VERBOSE(" - Surface is excluded surface");
+      } else if (prune != nullptr and
+                 not prune->mayReachBoundary(ib, window)) {
+        ACTS_VERBOSE(" - Surface is out of reach");
+      } else {
         auto bCandidate = bSurfaceRep.intersect(gctx, position, sDirection,
                                                 options.boundaryCheck);
         // Intersect and continue
@@ -573,8 +597,6 @@ Acts::TrackingVolume::compatibleBoundaries(
         } else {
           ACTS_VERBOSE(" - Surface intersecion invalid");
         }
-      } else {
-        ACTS_VERBOSE(" - Surface is excluded surface");
       }
     }
   };
@@ -582,16 +604,15 @@ Acts::TrackingVolume::compatibleBoundaries(
   // Process the boundaries of the current volume
   auto& bSurfaces = boundarySurfaces();
   ACTS_VERBOSE("Volume reports " << bSurfaces.size() << " boundary surfaces");
-  processBoundaries(bSurfaces);
+  processBoundaries(bSurfaces, m_extentPrune.get());
 
   // Process potential boundaries of contained volumes
-  auto confinedDenseVolumes = denseVolumes();
-  ACTS_VERBOSE("Volume reports " << confinedDenseVolumes.size()
+  ACTS_VERBOSE("Volume reports " << m_confinedDenseVolumes.size()
                                  << " confined dense volumes");
-  for (const auto& dv : confinedDenseVolumes) {
+  for (const auto& dv : m_confinedDenseVolumes) {
     auto& bSurfacesConfined = dv->boundarySurfaces();
     ACTS_VERBOSE(" -> " << bSurfacesConfined.size() << " boundary surfaces");
-    processBoundaries(bSurfacesConfined);
+    processBoundaries(bSurfacesConfined, nullptr);
   }
 
   // Sort them accordingly to the navigation direction
@@ -600,7 +621,6 @@ Acts::TrackingVolume::compatibleBoundaries(
   } else {
     std::sort(bIntersections.begin(), bIntersections.end(), std::greater<>());
   }
-  return bIntersections;
 }
 
 std::vector<Acts::LayerIntersection> Acts::TrackingVolume::compatibleLayers(
@@ -608,9 +628,22 @@ std::vector<Acts::LayerIntersection> Acts::TrackingVolume::compatibleLayers(
     const Vector3& direction, const NavigationOptions<Layer>& options) const {
   // the layer intersections which are valid
   std::vector<LayerIntersection> lIntersections;
+  compatibleLayers(gctx, position, direction, options, lIntersections);
+  return lIntersections;
+}
+
+void Acts::TrackingVolume::compatibleLayers(
+    const GeometryContext& gctx, const Vector3& position,
+    const Vector3& direction, const NavigationOptions<Layer>& options,
+    std::vector<LayerIntersection>& lIntersections) const {
+  lIntersections.clear();
 
   // the confinedLayers
   if (m_confinedLayers != nullptr) {
+    // the region covered by the straight line within the limits
+    VolumeExtentPrune::LineWindow window(
+        position, options.navDir * direction,
+        std::min(options.overstepLimit, 0.), std::abs(options.pathLimit));
     // start layer given or not - test layer
     const Layer* tLayer = options.startObject != nullptr
                               ? options.startObject
@@ -621,7 +654,10 @@ std::vector<Acts::LayerIntersection> Acts::TrackingVolume::compatibleLayers(
       // - resolveMaterial -> always take layer if it has material
       // - resolvePassive -> always take, unless it's a navigation layer
       // skip the start object
-      if (tLayer != options.startObject && tLayer->resolve(options)) {
+      // skip layers that can not be reached within the limits
+      if (tLayer != options.startObject && tLayer->resolve(options) &&
+          (m_extentPrune == nullptr ||
+           m_extentPrune->mayReach(*tLayer, window))) {
         // if it's a resolveable start layer, you are by definition on it
         // layer on approach intersection
         auto atIntersection =
@@ -650,8 +686,6 @@ std::vector<Acts::LayerIntersection> Acts::TrackingVolume::compatibleLayers(
       std::sort(lIntersections.begin(), lIntersections.end(), std::greater<>());
     }
   }
-  // and return
-  return lIntersections;
 }
 
 namespace {
@@ -13,7 +13,7 @@
 #include "Acts/Geometry/TrackingVolume.hpp"
 #include "Acts/Geometry/VolumeBounds.hpp"
 #include "Acts/Utilities/BinUtility.hpp"
-#include "Acts/Utilities/BinnedArrayXD.hpp"
+#include "Acts/Utilities/BinnedArrayFlat.hpp"
 
 #include <algorithm>
 #include <vector>
@@ -61,6 +61,6 @@ Acts::TrackingVolumeArrayCreator::trackingVolumeArray(
       std::make_unique<const BinUtility>(boundaries, open, bValue);
 
   // and return the newly created binned array
-  return std::make_shared<const BinnedArrayXD<TrackingVolumePtr>>(
+  return std::make_shared<const BinnedArrayFlat<TrackingVolumePtr, 1>>(
       tVolumesOrdered, std::move(binUtility));
 }
@@ -0,0 +1,179 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Geometry/VolumeExtentPrune.hpp"
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Geometry/ApproachDescriptor.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/Layer.hpp"
+#include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/Surfaces/CylinderBounds.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+// Margin added to all extents to cover intersection tolerances
+constexpr double kMargin = 1 * Acts::UnitConstants::mm;
+// Tolerance on the alignment with the global z axis
+constexpr double kAxisTolerance = 1e-6;
+
+// Radius of a z-aligned cylinder or z position of a disc perpendicular to z.
+//
+// @return false if the surface can not be tabulated
+bool surfaceExtent(const Acts::Surface& surface, bool& radial, double& value) {
+  // aligned surfaces can move; their position is only known in context
+  if (surface.associatedDetectorElement() != nullptr) {
+    return false;
+  }
+  const Acts::Transform3& transform =
+      surface.transform(Acts::GeometryContext());
+  const Acts::Vector3 axis = transform.rotation().col(2);
+  if (std::abs(std::abs(axis.z()) - 1) > kAxisTolerance) {
+    return false;
+  }
+  if (surface.type() == Acts::Surface::Cylinder) {
+    if (kAxisTolerance < transform.translation().head<2>().norm()) {
+      return false;
+    }
+    radial = true;
+    value = static_cast<const Acts::CylinderBounds&>(surface.bounds())
+                .get(Acts::CylinderBounds::eR);
+    return true;
+  }
+  if (surface.type() == Acts::Surface::Disc) {
+    radial = false;
+    value = transform.translation().z();
+    return true;
+  }
+  return false;
+}
+
+}  // namespace
+
+Acts::VolumeExtentPrune::LineWindow::LineWindow(const Vector3& position,
+                                                const Vector3& direction,
+                                                double sMin, double sMax) {
+  // an infinite path limit would produce NaNs for vanishing components
+  constexpr double kMaxPath = std::numeric_limits<double>::max();
+  sMin = std::clamp(sMin, -kMaxPath, kMaxPath);
+  sMax = std::clamp(sMax, sMin, kMaxPath);
+
+  const double z0 = position.z() + sMin * direction.z();
+  const double z1 = position.z() + sMax * direction.z();
+  zMin = std::min(z0, z1);
+  zMax = std::max(z0, z1);
+
+  // the squared transverse distance is a parabola in the path length
+  const Vector2 pT = position.head<2>();
+  const Vector2 dT = direction.head<2>();
+  auto r2 = [&](double s) { return (pT + s * dT).squaredNorm(); };
+  const double dT2 = dT.squaredNorm();
+  const double sClosest =
+      (0 < dT2) ? std::clamp(-pT.dot(dT) / dT2, sMin, sMax) : sMin;
+  rMin = std::sqrt(r2(sClosest));
+  rMax = std::sqrt(std::max(r2(sMin), r2(sMax)));
+}
+
+std::unique_ptr<const Acts::VolumeExtentPrune> Acts::VolumeExtentPrune::create(
+    const TrackingVolume& volume) {
+  auto prune = std::unique_ptr<VolumeExtentPrune>(new VolumeExtentPrune);
+  bool tabulated = false;
+
+  // layers are reached via their approach surfaces, if any, otherwise via
+  // their representing surface
+  if (volume.confinedLayers() != nullptr) {
+    const auto& layers = volume.confinedLayers()->arrayObjects();
+    prune->m_layers.resize(layers.size());
+    for (const auto& layer : layers) {
+      // the layer identifiers are assigned consecutively on closure
+      const size_t ilayer = layer->geometryId().layer();
+      if (ilayer == 0 or layers.size() < ilayer) {
+        continue;
+      }
+      Entry entry;
+      double value = 0;
+      if (not surfaceExtent(layer->surfaceRepresentation(), entry.radial,
+                            value)) {
+        continue;
+      }
+      entry.min = value - 0.5 * layer->thickness();
+      entry.max = value + 0.5 * layer->thickness();
+      bool complete = true;
+      if (layer->approachDescriptor() != nullptr) {
+        for (const Surface* surface :
+             layer->approachDescriptor()->containedSurfaces()) {
+          bool radial = false;
+          if (not surfaceExtent(*surface, radial, value) or
+              radial != entry.radial) {
+            complete = false;
+            break;
+          }
+          entry.min = std::min(entry.min, value);
+          entry.max = std::max(entry.max, value);
+        }
+      }
+      if (complete) {
+        entry.object = layer.get();
+        entry.min -= kMargin;
+        entry.max += kMargin;
+        prune->m_layers[ilayer - 1] = entry;
+        tabulated = true;
+      }
+    }
+  }
+  const auto& boundaries = volume.boundarySurfaces();
+  prune->m_boundaries.resize(boundaries.size());
+  for (size_t i = 0; i < boundaries.size(); ++i) {
+    const Surface& surface = boundaries[i]->surfaceRepresentation();
+    Entry& entry = prune->m_boundaries[i];
+    double value = 0;
+    if (surfaceExtent(surface, entry.radial, value)) {
+      entry.object = &surface;
+      entry.min = value - kMargin;
+      entry.max = value + kMargin;
+      tabulated = true;
+    }
+  }
+
+  if (not tabulated) {
+    return nullptr;
+  }
+  return prune;
+}
+
+bool Acts::VolumeExtentPrune::mayReach(const Layer& layer,
+                                       const LineWindow& window) const {
+  const size_t ilayer = layer.geometryId().layer();
+  if (ilayer == 0 or m_layers.size() < ilayer) {
+    return true;
+  }
+  const Entry& entry = m_layers[ilayer - 1];
+  // layers of other volumes or untabulated ones are never pruned
+  return (entry.object != &layer) or entry.overlaps(window);
+}
+
+bool Acts::VolumeExtentPrune::mayReachBoundary(size_t iboundary,
+                                               const LineWindow& window) const {
+  if (m_boundaries.size() <= iboundary) {
+    return true;
+  }
+  const Entry& entry = m_boundaries[iboundary];
+  return (entry.object == nullptr) or entry.overlaps(window);
+}
+
+bool Acts::VolumeExtentPrune::Entry::overlaps(const LineWindow& window) const {
+  if (radial) {
+    return (window.rMin <= max) and (min <= window.rMax);
+  }
+  return (window.zMin <= max) and (min <= window.zMax);
+}
@@ -12,6 +12,7 @@
 #include "Acts/Material/HomogeneousSurfaceMaterial.hpp"
 #include "Acts/Material/ISurfaceMaterial.hpp"
 
+#include <stdexcept>
 #include <utility>
 
 // Default Constructor - for homogeneous material
@@ -63,8 +64,18 @@ void Acts::AccumulatedSurfaceMaterial::trackAverage(const Vector3& gp,
     m_accumulatedMaterial[0][0].trackAverage();
   }
   std::array<size_t, 3> bTriple = m_binUtility.binTriple(gp);
-  std::vector<std::array<size_t, 3>> trackBins = {bTriple};
-  trackAverage(trackBins, emptyHit);
+  trackAverage(bTriple, emptyHit);
+}
+
+// Average the information accumulated during one event in a single bin
+void Acts::AccumulatedSurfaceMaterial::trackAverage(
+    const std::array<size_t, 3>& trackBin, bool emptyHit) {
+  // the homogeneous material case
+  if (m_binUtility.dimensions() == 0) {
+    m_accumulatedMaterial[0][0].trackAverage(emptyHit);
+    return;
+  }
+  m_accumulatedMaterial[trackBin[1]][trackBin[0]].trackAverage(emptyHit);
 }
 
 // Average the information accumulated during one event
@@ -91,6 +102,25 @@ void Acts::AccumulatedSurfaceMaterial::trackAverage(
   }
 }
 
+// Merge the accumulated material of an independent set of tracks
+void Acts::AccumulatedSurfaceMaterial::merge(
+    const AccumulatedSurfaceMaterial& other) {
+  const auto& otherMaterial = other.m_accumulatedMaterial;
+  bool matching = (m_accumulatedMaterial.size() == otherMaterial.size());
+  for (size_t ib1 = 0; matching and ib1 < otherMaterial.size(); ++ib1) {
+    matching = (m_accumulatedMaterial[ib1].size() == otherMaterial[ib1].size());
+  }
+  if (not matching) {
+    throw std::invalid_argument(
+        "AccumulatedSurfaceMaterial: can not merge different binnings");
+  }
+  for (size_t ib1 = 0; ib1 < otherMaterial.size(); ++ib1) {
+    for (size_t ib0 = 0; ib0 < otherMaterial[ib1].size(); ++ib0) {
+      m_accumulatedMaterial[ib1][ib0].merge(otherMaterial[ib1][ib0]);
+    }
+  }
+}
+
 /// Total average creates SurfaceMaterial
 std::unique_ptr<const Acts::ISurfaceMaterial>
 Acts::AccumulatedSurfaceMaterial::totalAverage() {
@@ -11,8 +11,10 @@
 #include "Acts/Material/Material.hpp"
 #include "Acts/Utilities/PdgParticle.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <stdexcept>
 
 using namespace Acts::UnitLiterals;
 
@@ -512,3 +514,188 @@ float Acts::computeMultipleScatteringTheta0(const MaterialSlab& slab, int pdg,
     return theta0Highland(xOverX0, momentumInv, q2OverBeta2);
   }
 }
+
+Acts::InteractionsTable::InteractionsTable(const Config& cfg,
+                                           const Material& material, int pdg,
+                                           float m, float q)
+    : m_cfg(cfg),
+      m_material(material),
+      m_pdg(pdg),
+      m_mass(m),
+      m_absQ(std::abs(q)) {
+  if (not m_material) {
+    throw std::invalid_argument("InteractionsTable: invalid material");
+  }
+  if (not(0 < m_mass and 0 < m_absQ)) {
+    throw std::invalid_argument("InteractionsTable: invalid particle");
+  }
+  if (not(0 < m_cfg.pMin and m_cfg.pMin < m_cfg.pMax)) {
+    throw std::invalid_argument("InteractionsTable: invalid momentum range");
+  }
+  const auto I = m_material.meanExcitationEnergy();
+  const auto Ne = m_material.molarElectronDensity();
+  m_epsilonScale = 0.5f * K * Ne;
+  m_logPlasmaOverI = std::log(PlasmaEnergyScale * std::sqrt(Ne) / I);
+  m_logPMin = std::log(m_cfg.pMin);
+
+  // refine until the interpolation is accurate enough
+  for (size_t nIntervals = 16; nIntervals < m_cfg.maxPoints;
+       nIntervals *= 2) {
+    fill(nIntervals);
+    m_maxRelativeError = validate();
+    if (m_maxRelativeError <= m_cfg.tolerance) {
+      return;
+    }
+  }
+  throw std::invalid_argument(
+      "InteractionsTable: tolerance not reached with the maximum points");
+}
+
+Acts::InteractionsTable::Node Acts::InteractionsTable::computeNode(
+    float momentum) const {
+  const auto I = m_material.meanExcitationEnergy();
+  const auto Ne = m_material.molarElectronDensity();
+  const auto rq = RelativisticQuantities(m_mass, m_absQ / momentum, m_absQ);
+  const auto u = computeMassTerm(Me, rq);
+  const auto wmax = computeWMax(m_mass, rq);
+  const auto t = computeMassTerm(m_mass, rq);
+  // unit thickness in native units
+  const auto eps = ::computeEpsilon(Ne, 1.0f, rq);
+
+  Node node;
+  node.bethe = 0.5f * std::log(u / I) + 0.5f * std::log(wmax / I) - rq.beta2;
+  node.landau = std::log(t / I) + std::log(eps / I) + 0.2f - rq.beta2;
+  return node;
+}
+
+void Acts::InteractionsTable::fill(size_t nIntervals) {
+  const auto logPMax = std::log(m_cfg.pMax);
+  m_invStep = nIntervals / (logPMax - m_logPMin);
+  m_nodes.resize(nIntervals + 1);
+  for (size_t i = 0; i <= nIntervals; ++i) {
+    m_nodes[i] = computeNode(std::exp(m_logPMin + i / m_invStep));
+  }
+}
+
+float Acts::InteractionsTable::validate() const {
+  const auto slab = MaterialSlab(m_material, 1_mm);
+
+  float maxError = 0.0f;
+  for (size_t i = 0; i + 1 < m_nodes.size(); ++i) {
+    const auto p = std::exp(m_logPMin + (i + 0.5f) / m_invStep);
+    const auto qOverP = m_absQ / p;
+    const auto bethe =
+        Acts::computeEnergyLossBethe(slab, m_pdg, m_mass, qOverP, m_absQ);
+    const auto landau =
+        Acts::computeEnergyLossLandau(slab, m_pdg, m_mass, qOverP, m_absQ);
+    const auto sigma = Acts::computeEnergyLossLandauSigma(slab, m_pdg, m_mass,
+                                                          qOverP, m_absQ);
+    const auto betheError =
+        std::abs(computeEnergyLossBethe(slab, qOverP) - bethe) / bethe;
+    const auto landauError =
+        std::abs(computeEnergyLossLandau(slab, qOverP) - landau) / sigma;
+    maxError = std::max({maxError, betheError, landauError});
+  }
+  return maxError;
+}
+
+bool Acts::InteractionsTable::interpolate(float qOverP, Node& node,
+                                          float& deltaHalf) const {
+  const auto momentum = m_absQ / std::abs(qOverP);
+  const auto logP = std::log(momentum);
+  const auto u = (logP - m_logPMin) * m_invStep;
+  const auto nIntervals = m_nodes.size() - 1;
+  if (not(0.0f <= u and u <= nIntervals)) {
+    return false;
+  }
+  const auto i = std::min(static_cast<size_t>(u), nIntervals - 1);
+  const auto f = u - i;
+  const Node& a = m_nodes[i];
+  const Node& b = m_nodes[i + 1];
+  node.bethe = a.bethe + f * (b.bethe - a.bethe);
+  node.landau = a.landau + f * (b.landau - a.landau);
+  // density correction, see computeDeltaHalf
+  deltaHalf = (momentum < 10.0f * m_mass)
+                  ? 0.0f
+                  : logP - std::log(m_mass) + m_logPlasmaOverI - 0.5f;
+  return true;
+}
+
+float Acts::InteractionsTable::computeEpsilon(float qOverP) const {
+  // see RelativisticQuantities and computeEpsilon
+  const auto mQOverP = m_mass * qOverP;
+  return m_epsilonScale * (m_absQ * m_absQ + mQOverP * mQOverP);
+}
+
+float Acts::InteractionsTable::computeEnergyLossBethe(const MaterialSlab& slab,
+                                                      float qOverP) const {
+  assert((slab.material() == m_material) and "Material must be tabulated");
+
+  if (not slab) {
+    return 0.0f;
+  }
+  Node node;
+  float dhalf = 0.0f;
+  if (not interpolate(qOverP, node, dhalf)) {
+    return Acts::computeEnergyLossBethe(slab, m_pdg, m_mass, qOverP, m_absQ);
+  }
+  return slab.thickness() * computeEpsilon(qOverP) * (node.bethe - dhalf);
+}
+
+float Acts::InteractionsTable::computeEnergyLossLandau(
+    const MaterialSlab& slab, float qOverP) const {
+  assert((slab.material() == m_material) and "Material must be tabulated");
+
+  if (not slab) {
+    return 0.0f;
+  }
+  Node node;
+  float dhalf = 0.0f;
+  if (not interpolate(qOverP, node, dhalf)) {
+    return Acts::computeEnergyLossLandau(slab, m_pdg, m_mass, qOverP, m_absQ);
+  }
+  // log(eps/I) = log(eps(x=1)/I) + log(x)
+  const auto x = slab.thickness();
+  return x * computeEpsilon(qOverP) * (node.landau + std::log(x) - 2 * dhalf);
+}
+
+float Acts::InteractionsTable::computeEnergyLossLandauSigma(
+    const MaterialSlab& slab, float qOverP) const {
+  assert((slab.material() == m_material) and "Material must be tabulated");
+
+  if (not slab) {
+    return 0.0f;
+  }
+  return convertLandauFwhmToGaussianSigma(4 * slab.thickness() *
+                                          computeEpsilon(qOverP));
+}
+
+float Acts::InteractionsTable::computeEnergyLossLandauSigmaQOverP(
+    const MaterialSlab& slab, float qOverP) const {
+  return Acts::computeEnergyLossLandauSigmaQOverP(slab, m_pdg, m_mass, qOverP,
+                                                  m_absQ);
+}
+
+float Acts::InteractionsTable::computeEnergyLossRadiative(
+    const MaterialSlab& slab, float qOverP) const {
+  return Acts::computeEnergyLossRadiative(slab, m_pdg, m_mass, qOverP, m_absQ);
+}
+
+float Acts::InteractionsTable::computeEnergyLossMean(const MaterialSlab& slab,
+                                                     float qOverP) const {
+  return computeEnergyLossBethe(slab, qOverP) +
+         computeEnergyLossRadiative(slab, qOverP);
+}
+
+float Acts::InteractionsTable::computeEnergyLossMode(const MaterialSlab& slab,
+                                                     float qOverP) const {
+  // same relative fractions as Acts::computeEnergyLossMode
+  return 0.9f * computeEnergyLossLandau(slab, qOverP) +
+         0.15f * computeEnergyLossRadiative(slab, qOverP);
+}
+
+float Acts::InteractionsTable::computeMultipleScatteringTheta0(
+    const MaterialSlab& slab, float qOverP) const {
+  return Acts::computeMultipleScatteringTheta0(slab, m_pdg, m_mass, qOverP,
+                                               m_absQ);
+}
@@ -33,6 +33,7 @@
 #include "Acts/Utilities/Helpers.hpp"
 #include "Acts/Utilities/Result.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <tuple>
 #include <utility>
@@ -43,7 +44,8 @@ Acts::SurfaceMaterialMapper::SurfaceMaterialMapper(
     std::unique_ptr<const Logger> slogger)
     : m_cfg(cfg),
       m_propagator(std::move(propagator)),
-      m_logger(std::move(slogger)) {}
+      m_logger(std::move(slogger)),
+      m_propagationLogger(getDefaultLogger("SufMatMapProp", Logging::INFO)) {}
 
 Acts::SurfaceMaterialMapper::State Acts::SurfaceMaterialMapper::createState(
     const GeometryContext& gctx, const MagneticFieldContext& mctx,
@@ -54,6 +56,7 @@ Acts::SurfaceMaterialMapper::State Acts::SurfaceMaterialMapper::createState(
   // The Surface material mapping state
   State mState(gctx, mctx);
   resolveMaterialSurfaces(mState, *world);
+  assignMaterialSlots(mState);
   collectMaterialVolumes(mState, *world);
 
   ACTS_DEBUG(mState.accumulatedMaterial.size()
@@ -113,6 +116,27 @@ void Acts::SurfaceMaterialMapper::resolveMaterialSurfaces(
   }
 }
 
+void Acts::SurfaceMaterialMapper::assignMaterialSlots(State& mState) const {
+  // The map is ordered, hence the slots are sorted by geometry ID
+  mState.slotIds.clear();
+  mState.slotMaterial.clear();
+  for (auto& [geoID, accMaterial] : mState.accumulatedMaterial) {
+    mState.slotIds.push_back(geoID);
+    mState.slotMaterial.push_back(&accMaterial);
+  }
+  mState.assignedMaterial.assign(mState.slotIds.size(), 0);
+}
+
+size_t Acts::SurfaceMaterialMapper::materialSlot(
+    const State& mState, const GeometryIdentifier& geoID) const {
+  auto slot =
+      std::lower_bound(mState.slotIds.begin(), mState.slotIds.end(), geoID);
+  if (slot == mState.slotIds.end() or not(*slot == geoID)) {
+    return mState.slotIds.size();
+  }
+  return slot - mState.slotIds.begin();
+}
+
 void Acts::SurfaceMaterialMapper::checkAndInsert(State& mState,
                                                  const Surface& surface) const {
   auto surfaceMaterial = surface.surfaceMaterial();
@@ -183,6 +207,23 @@ void Acts::SurfaceMaterialMapper::collectMaterialVolumes(
   }
 }
 
+void Acts::SurfaceMaterialMapper::mergeStates(State& mState,
+                                              State other) const {
+  bool newSurfaces = false;
+  for (auto& [geoID, accMaterial] : other.accumulatedMaterial) {
+    auto target = mState.accumulatedMaterial.find(geoID);
+    if (target == mState.accumulatedMaterial.end()) {
+      mState.accumulatedMaterial.emplace(geoID, std::move(accMaterial));
+      newSurfaces = true;
+    } else {
+      target->second.merge(accMaterial);
+    }
+  }
+  if (newSurfaces) {
+    assignMaterialSlots(mState);
+  }
+}
+
 void Acts::SurfaceMaterialMapper::finalizeMaps(State& mState) const {
   // iterate over the map to call the total average
   for (auto& accMaterial : mState.accumulatedMaterial) {
@@ -208,21 +249,19 @@ void Acts::SurfaceMaterialMapper::mapMaterialTrack(
       ActionList<MaterialSurfaceCollector, MaterialVolumeCollector>;
   using AbortList = AbortList<EndOfWorldReached>;
 
-  auto propLogger = getDefaultLogger("SufMatMapProp", Logging::INFO);
   PropagatorOptions<ActionList, AbortList> options(
-      mState.geoContext, mState.magFieldContext, LoggerWrapper{*propLogger});
+      mState.geoContext, mState.magFieldContext,
+      LoggerWrapper{*m_propagationLogger});
 
   // Now collect the material layers by using the straight line propagator
   const auto& result = m_propagator.propagate(start, options).value();
-  auto mcResult = result.get<MaterialSurfaceCollector::result_type>();
-  auto mvcResult = result.get<MaterialVolumeCollector::result_type>();
-
-  auto mappingSurfaces = mcResult.collected;
-  auto mappingVolumes = mvcResult.collected;
+  const auto& mappingSurfaces =
+      result.get<MaterialSurfaceCollector::result_type>().collected;
+  const auto& mappingVolumes =
+      result.get<MaterialVolumeCollector::result_type>().collected;
 
   // Retrieve the recorded material from the recorded material track
   auto& rMaterial = mTrack.second.materialInteractions;
-  std::map<GeometryIdentifier, unsigned int> assignedMaterial;
   ACTS_VERBOSE("Retrieved " << rMaterial.size()
                             << " recorded material steps to map.")
 
@@ -230,12 +269,18 @@ void Acts::SurfaceMaterialMapper::mapMaterialTrack(
   ACTS_VERBOSE("Found     " << mappingSurfaces.size()
                             << " mapping surfaces for this track.");
   ACTS_VERBOSE("Mapping surfaces are :")
+  const size_t noSlot = mState.slotIds.size();
+  auto& trackSlots = mState.trackSlots;
+  auto& assignedMaterial = mState.assignedMaterial;
+  auto& touchedMapBins = mState.touchedMapBins;
+  trackSlots.clear();
+  touchedMapBins.clear();
   for (auto& mSurface : mappingSurfaces) {
     ACTS_VERBOSE(" - Surface : " << mSurface.surface->geometryId()
                                  << " at position = (" << mSurface.position.x()
                                  << ", " << mSurface.position.y() << ", "
                                  << mSurface.position.z() << ")");
-    assignedMaterial[mSurface.surface->geometryId()] = 0;
+    trackSlots.push_back(materialSlot(mState, mSurface.surface->geometryId()));
   }
 
   // Run the mapping process, i.e. take the recorded material and map it
@@ -248,16 +293,10 @@ void Acts::SurfaceMaterialMapper::mapMaterialTrack(
   auto volIter = mappingVolumes.begin();
 
   // Use those to minimize the lookup
-  GeometryIdentifier lastID = GeometryIdentifier();
-  GeometryIdentifier currentID = GeometryIdentifier();
+  size_t lastSlot = noSlot;
+  size_t currentSlot = noSlot;
   Vector3 currentPos(0., 0., 0);
   double currentPathCorrection = 0.;
-  auto currentAccMaterial = mState.accumulatedMaterial.end();
-
-  // To remember the bins of this event
-  using MapBin = std::pair<AccumulatedSurfaceMaterial*, std::array<size_t, 3>>;
-  std::multimap<AccumulatedSurfaceMaterial*, std::array<size_t, 3>>
-      touchedMapBins;
 
   // Assign the recorded ones, break if you hit an end
   while (rmIter != rMaterial.end() && sfIter != mappingSurfaces.end()) {
@@ -284,22 +323,26 @@ void Acts::SurfaceMaterialMapper::mapMaterialTrack(
       // Switch to next assignment surface
       ++sfIter;
     }
-    // get the current Surface ID
-    currentID = sfIter->surface->geometryId();
+    // get the current Surface slot
+    currentSlot = trackSlots[sfIter - mappingSurfaces.begin()];
+    // Surfaces unknown to the state can not take material
+    if (currentSlot == noSlot) {
+      ++rmIter;
+      continue;
+    }
     // We have work to do: the assignemnt surface has changed
-    if (not(currentID == lastID)) {
+    if (currentSlot != lastSlot) {
       // Let's (re-)assess the information
-      lastID = currentID;
+      lastSlot = currentSlot;
       currentPos = (sfIter)->position;
       currentPathCorrection = sfIter->surface->pathCorrection(
           mState.geoContext, currentPos, sfIter->direction);
-      currentAccMaterial = mState.accumulatedMaterial.find(currentID);
     }
     // Now assign the material for the accumulation process
-    auto tBin = currentAccMaterial->second.accumulate(
+    auto tBin = mState.slotMaterial[currentSlot]->accumulate(
         currentPos, rmIter->materialSlab, currentPathCorrection);
-    touchedMapBins.insert(MapBin(&(currentAccMaterial->second), tBin));
-    ++assignedMaterial[currentID];
+    touchedMapBins.emplace_back(currentSlot, tBin);
+    ++assignedMaterial[currentSlot];
     // Update the material interaction with the associated surface
     rmIter->surface = sfIter->surface;
     // Switch to next material
@@ -307,29 +350,36 @@ void Acts::SurfaceMaterialMapper::mapMaterialTrack(
   }
 
   ACTS_VERBOSE("Surfaces have following number of assigned hits :")
-  for (auto& [key, value] : assignedMaterial) {
-    ACTS_VERBOSE(" + Surface : " << key << " has " << value << " hits.");
+  for (size_t slot : trackSlots) {
+    if (slot != noSlot) {
+      ACTS_VERBOSE(" + Surface : " << mState.slotIds[slot] << " has "
+                                   << assignedMaterial[slot] << " hits.");
+    }
   }
 
   // After mapping this track, average the touched bins
-  for (auto tmapBin : touchedMapBins) {
-    std::vector<std::array<size_t, 3>> trackBins = {tmapBin.second};
-    tmapBin.first->trackAverage(trackBins);
+  for (const auto& [slot, bin] : touchedMapBins) {
+    mState.slotMaterial[slot]->trackAverage(bin);
   }
 
   // After mapping this track, average the untouched but intersected bins
-  if (m_cfg.emptyBinCorrection) {
-    // Use the assignedMaterial map to account for empty hits, i.e.
+  // and reset the assigned steps for the next track
+  for (size_t isf = 0; isf < mappingSurfaces.size(); ++isf) {
+    size_t slot = trackSlots[isf];
+    if (slot == noSlot) {
+      continue;
+    }
+    // Use the assigned material to account for empty hits, i.e.
     // the material surface has been intersected by the mapping ray
     // but no material step was assigned to this surface
-    for (auto& mSurface : mappingSurfaces) {
-      auto mgID = mSurface.surface->geometryId();
-      // Count an empty hit only if the surface does not appear in the
-      // list of assigned surfaces
-      if (assignedMaterial[mgID] == 0) {
-        auto missedMaterial = mState.accumulatedMaterial.find(mgID);
-        missedMaterial->second.trackAverage(mSurface.position, true);
-      }
+    if (m_cfg.emptyBinCorrection and assignedMaterial[slot] == 0) {
+      mState.slotMaterial[slot]->trackAverage(mappingSurfaces[isf].position,
+                                              true);
+    }
+  }
+  for (size_t slot : trackSlots) {
+    if (slot != noSlot) {
+      assignedMaterial[slot] = 0;
     }
   }
 }
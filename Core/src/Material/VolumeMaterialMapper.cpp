@@ -35,7 +35,9 @@
 #include "Acts/Utilities/detail/AxisFwd.hpp"
 #include "Acts/Utilities/detail/Grid.hpp"
 
+#include <algorithm>
 #include <iosfwd>
+#include <iterator>
 #include <stdexcept>
 #include <tuple>
 
@@ -57,7 +59,8 @@ Acts::VolumeMaterialMapper::VolumeMaterialMapper(
     std::unique_ptr<const Logger> slogger)
     : m_cfg(cfg),
       m_propagator(std::move(propagator)),
-      m_logger(std::move(slogger)) {}
+      m_logger(std::move(slogger)),
+      m_propagationLogger(getDefaultLogger("Propagator", Logging::INFO)) {}
 
 Acts::VolumeMaterialMapper::State Acts::VolumeMaterialMapper::createState(
     const GeometryContext& gctx, const MagneticFieldContext& mctx,
@@ -68,6 +71,7 @@ Acts::VolumeMaterialMapper::State Acts::VolumeMaterialMapper::createState(
   // The Surface material mapping state
   State mState(gctx, mctx);
   resolveMaterialVolume(mState, *world);
+  assignMaterialSlots(mState);
   collectMaterialSurfaces(mState, *world);
   return mState;
 }
@@ -96,6 +100,26 @@ void Acts::VolumeMaterialMapper::resolveMaterialVolume(
   }
 }
 
+void Acts::VolumeMaterialMapper::assignMaterialSlots(State& mState) const {
+  // The map is ordered, hence the slots are sorted by geometry ID
+  mState.slotIds.clear();
+  mState.slotMaterial.clear();
+  for (auto& [geoID, recMaterial] : mState.recordedMaterial) {
+    mState.slotIds.push_back(geoID);
+    mState.slotMaterial.push_back(&recMaterial);
+  }
+}
+
+size_t Acts::VolumeMaterialMapper::materialSlot(
+    const State& mState, const GeometryIdentifier& geoID) const {
+  auto slot =
+      std::lower_bound(mState.slotIds.begin(), mState.slotIds.end(), geoID);
+  if (slot == mState.slotIds.end() or not(*slot == geoID)) {
+    return mState.slotIds.size();
+  }
+  return slot - mState.slotIds.begin();
+}
+
 void Acts::VolumeMaterialMapper::checkAndInsert(
     State& mState, const TrackingVolume& volume) const {
   auto volumeMaterial = volume.volumeMaterial();
@@ -207,28 +231,44 @@ void Acts::VolumeMaterialMapper::collectMaterialSurfaces(
 void Acts::VolumeMaterialMapper::createExtraHits(
     RecordedMaterialVolumePoint& matPoint, Acts::MaterialSlab properties,
     Vector3 position, Vector3 direction) const {
-  std::vector<Acts::Vector3> extraPosition;
-  std::vector<Acts::Vector3> extraRemainderPositions;
-
   int volumeStep = floor(properties.thickness() / m_cfg.mappingStep);
   float remainder = properties.thickness() - m_cfg.mappingStep * volumeStep;
   properties.scaleThickness(m_cfg.mappingStep / properties.thickness());
   direction = direction * (m_cfg.mappingStep / direction.norm());
 
+  // Fill the points in place instead of copying them
+  auto& extraPosition =
+      matPoint.emplace_back(properties, std::vector<Acts::Vector3>()).second;
+  extraPosition.reserve(volumeStep);
   for (int extraStep = 0; extraStep < volumeStep; extraStep++) {
     // Create additional extrapolated points for the grid mapping
     extraPosition.push_back(position + extraStep * direction);
   }
-  matPoint.push_back(std::pair(properties, extraPosition));
 
   if (remainder > 0) {
     // adjust the thickness of the last extrapolated step
     properties.scaleThickness(remainder / properties.thickness());
-    extraRemainderPositions.push_back(position + volumeStep * direction);
-    matPoint.push_back(std::pair(properties, extraRemainderPositions));
+    matPoint.emplace_back(
+        properties,
+        std::vector<Acts::Vector3>{position + volumeStep * direction});
   }
 }
 
+void Acts::VolumeMaterialMapper::mergeStates(State& mState,
+                                             State other) const {
+  const size_t nVolumes = mState.recordedMaterial.size();
+  for (auto& [geoID, recMaterial] : other.recordedMaterial) {
+    auto& target = mState.recordedMaterial[geoID];
+    target.insert(target.end(), std::make_move_iterator(recMaterial.begin()),
+                  std::make_move_iterator(recMaterial.end()));
+  }
+  if (mState.recordedMaterial.size() != nVolumes) {
+    assignMaterialSlots(mState);
+  }
+  // the binning is identical for states of the same geometry
+  mState.materialBin.merge(other.materialBin);
+}
+
 void Acts::VolumeMaterialMapper::finalizeMaps(State& mState) const {
   // iterate over the volumes
   for (auto& recMaterial : mState.recordedMaterial) {
@@ -289,17 +329,16 @@ void Acts::VolumeMaterialMapper::mapMaterialTrack(
   using ActionList = ActionList<BoundSurfaceCollector, MaterialVolumeCollector>;
   using AbortList = AbortList<EndOfWorldReached>;
 
-  auto propLogger = getDefaultLogger("Propagator", Logging::INFO);
   PropagatorOptions<ActionList, AbortList> options(
-      mState.geoContext, mState.magFieldContext, LoggerWrapper{*propLogger});
+      mState.geoContext, mState.magFieldContext,
+      LoggerWrapper{*m_propagationLogger});
 
   // Now collect the material volume by using the straight line propagator
   const auto& result = m_propagator.propagate(start, options).value();
-  auto mcResult = result.get<BoundSurfaceCollector::result_type>();
-  auto mvcResult = result.get<MaterialVolumeCollector::result_type>();
-
-  auto mappingSurfaces = mcResult.collected;
-  auto mappingVolumes = mvcResult.collected;
+  const auto& mappingSurfaces =
+      result.get<BoundSurfaceCollector::result_type>().collected;
+  const auto& mappingVolumes =
+      result.get<MaterialVolumeCollector::result_type>().collected;
 
   // Retrieve the recorded material from the recorded material track
   auto& rMaterial = mTrack.second.materialInteractions;
@@ -315,8 +354,6 @@ void Acts::VolumeMaterialMapper::mapMaterialTrack(
                                 << " at position = (" << mVolumes.position.x()
                                 << ", " << mVolumes.position.y() << ", "
                                 << mVolumes.position.z() << ")");
-
-    mappingVolumes.push_back(mVolumes);
   }
   // Run the mapping process, i.e. take the recorded material and map it
   // onto the mapping volume:
@@ -327,7 +364,7 @@ void Acts::VolumeMaterialMapper::mapMaterialTrack(
   // Use those to minimize the lookup
   GeometryIdentifier lastID = GeometryIdentifier();
   GeometryIdentifier currentID = GeometryIdentifier();
-  auto currentRecMaterial = mState.recordedMaterial.end();
+  RecordedMaterialVolumePoint* currentRecMaterial = nullptr;
 
   // store end position of the last material slab
   Acts::Vector3 lastPositionEnd = {0, 0, 0};
@@ -358,18 +395,21 @@ void Acts::VolumeMaterialMapper::mapMaterialTrack(
         // Let's (re-)assess the information
         lastID = currentID;
         lastPositionEnd = volIter->position;
-        currentRecMaterial = mState.recordedMaterial.find(currentID);
+        size_t slot = materialSlot(mState, currentID);
+        currentRecMaterial = (slot < mState.slotMaterial.size())
+                                 ? mState.slotMaterial[slot]
+                                 : nullptr;
       }
       // If the curent volume has a ProtoVolumeMaterial
       // and the material hit has a non 0 thickness
-      if (currentRecMaterial != mState.recordedMaterial.end() &&
+      if (currentRecMaterial != nullptr &&
           rmIter->materialSlab.thickness() > 0) {
         // check if there is vacuum between this material point and the last one
         float vacuumThickness = (rmIter->position - lastPositionEnd).norm();
         if (vacuumThickness > s_epsilon) {
           auto properties = Acts::MaterialSlab(vacuumThickness);
           // creat vacuum hits
-          createExtraHits(currentRecMaterial->second, properties,
+          createExtraHits(*currentRecMaterial, properties,
                           lastPositionEnd, direction);
         }
         // determine the position of the last material slab using the track
@@ -379,7 +419,7 @@ void Acts::VolumeMaterialMapper::mapMaterialTrack(
             direction * (rmIter->materialSlab.thickness() / direction.norm());
         lastPositionEnd = rmIter->position + direction;
         // create additional material point
-        createExtraHits(currentRecMaterial->second, rmIter->materialSlab,
+        createExtraHits(*currentRecMaterial, rmIter->materialSlab,
                         rmIter->position, direction);
       }
 
@@ -400,9 +440,10 @@ void Acts::VolumeMaterialMapper::mapMaterialTrack(
                   (sfIter->position - lastPositionEnd).norm();
               // if the last material slab stop before the boundary surface
               // create vacuum hits
-              if (vacuumThickness > s_epsilon) {
+              if (currentRecMaterial != nullptr &&
+                  vacuumThickness > s_epsilon) {
                 auto properties = Acts::MaterialSlab(vacuumThickness);
-                createExtraHits(currentRecMaterial->second, properties,
+                createExtraHits(*currentRecMaterial, properties,
                                 lastPositionEnd, direction);
                 lastPositionEnd = sfIter->position;
               }
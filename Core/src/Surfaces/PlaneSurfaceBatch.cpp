@@ -0,0 +1,146 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Surfaces/PlaneSurfaceBatch.hpp"
+
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+
+#include <cmath>
+#include <limits>
+
+namespace {
+
+// Coefficient-wise projection of a vector onto one row per surface; written
+// out per component such that no temporary is allocated
+template <typename rows_t>
+auto project(const rows_t& rows, const Acts::Vector3& vector) {
+  return rows.col(0).array() * vector.x() + rows.col(1).array() * vector.y() +
+         rows.col(2).array() * vector.z();
+}
+
+}  // namespace
+
+Acts::PlaneSurfaceBatch::PlaneSurfaceBatch(
+    const GeometryContext& gctx, std::vector<const PlaneSurface*> surfaces)
+    : m_surfaces(std::move(surfaces)) {
+  const auto n = static_cast<Eigen::Index>(m_surfaces.size());
+  m_axis0.resize(n, 3);
+  m_axis1.resize(n, 3);
+  m_normal.resize(n, 3);
+  m_center0.resize(n);
+  m_center1.resize(n);
+  m_centerN.resize(n);
+  m_min0.resize(n);
+  m_max0.resize(n);
+  m_min1.resize(n);
+  m_max1.resize(n);
+
+  constexpr ActsScalar inf = std::numeric_limits<ActsScalar>::infinity();
+  for (Eigen::Index i = 0; i < n; ++i) {
+    const PlaneSurface& surface = *m_surfaces[i];
+    const auto& tMatrix = surface.transform(gctx).matrix();
+    const Vector3 center = tMatrix.block<3, 1>(0, 3);
+    m_axis0.row(i) = tMatrix.block<3, 1>(0, 0).transpose();
+    m_axis1.row(i) = tMatrix.block<3, 1>(0, 1).transpose();
+    m_normal.row(i) = tMatrix.block<3, 1>(0, 2).transpose();
+    m_center0(i) = m_axis0.row(i).dot(center);
+    m_center1(i) = m_axis1.row(i).dot(center);
+    m_centerN(i) = m_normal.row(i).dot(center);
+
+    if (surface.bounds().type() == SurfaceBounds::eRectangle) {
+      const auto& rBounds =
+          static_cast<const RectangleBounds&>(surface.bounds());
+      m_min0(i) = rBounds.min().x();
+      m_max0(i) = rBounds.max().x();
+      m_min1(i) = rBounds.min().y();
+      m_max1(i) = rBounds.max().y();
+    } else {
+      m_min0(i) = m_min1(i) = -inf;
+      m_max0(i) = m_max1(i) = inf;
+      m_generic.push_back(static_cast<size_t>(i));
+    }
+  }
+}
+
+void Acts::PlaneSurfaceBatch::intersect(const Vector3& position,
+                                        const Vector3& direction,
+                                        const BoundaryCheck& bcheck,
+                                        Intersections& intersections) const {
+  const size_t n = size();
+  Scalars& path = intersections.pathLength;
+  Scalars& loc0 = intersections.loc0;
+  Scalars& loc1 = intersections.loc1;
+  auto& status = intersections.status;
+
+  // vectorized over all surfaces; a vanishing denominator, i.e. a line
+  // parallel to the plane, yields a non-finite path
+  path = (m_centerN - project(m_normal, position)) /
+         project(m_normal, direction);
+  loc0 = project(m_axis0, position) - m_center0 +
+         path * project(m_axis0, direction);
+  loc1 = project(m_axis1, position) - m_center1 +
+         path * project(m_axis1, direction);
+
+  // the rectangular boundary check is exact for absolute tolerances
+  const bool checkRectangles =
+      bcheck and bcheck.type() == BoundaryCheck::Type::eAbsolute;
+  const ActsScalar tol0 = checkRectangles ? bcheck.tolerance()[0] : 0;
+  const ActsScalar tol1 = checkRectangles ? bcheck.tolerance()[1] : 0;
+  constexpr ActsScalar tol2 = s_onSurfaceTolerance * s_onSurfaceTolerance;
+
+  status.resize(n);
+  for (size_t i = 0; i < n; ++i) {
+    if (not std::isfinite(path[i])) {
+      path[i] = std::numeric_limits<ActsScalar>::infinity();
+      status[i] = Intersection3D::Status::unreachable;
+      continue;
+    }
+    const bool inside =
+        not checkRectangles or
+        ((m_min0[i] - tol0 <= loc0[i]) & (loc0[i] <= m_max0[i] + tol0) &
+         (m_min1[i] - tol1 <= loc1[i]) & (loc1[i] <= m_max1[i] + tol1));
+    status[i] = not inside ? Intersection3D::Status::missed
+                : (path[i] * path[i] < tol2)
+                    ? Intersection3D::Status::onSurface
+                    : Intersection3D::Status::reachable;
+  }
+
+  if (not bcheck) {
+    return;
+  }
+  // remaining lanes are checked by their bounds
+  auto checkLane = [&](size_t i) {
+    if (status[i] != Intersection3D::Status::missed and
+        not m_surfaces[i]->insideBounds(Vector2(loc0[i], loc1[i]), bcheck)) {
+      status[i] = Intersection3D::Status::missed;
+    }
+  };
+  if (checkRectangles) {
+    for (size_t i : m_generic) {
+      checkLane(i);
+    }
+  } else {
+    for (size_t i = 0; i < n; ++i) {
+      checkLane(i);
+    }
+  }
+}
+
+Acts::SurfaceIntersection Acts::PlaneSurfaceBatch::surfaceIntersection(
+    const Intersections& intersections, size_t index, const Vector3& position,
+    const Vector3& direction) const {
+  // missed and unreachable share the status value, only the path differs
+  const ActsScalar path = intersections.pathLength[index];
+  if (not std::isfinite(path)) {
+    return {Intersection3D(), m_surfaces[index]};
+  }
+  return {Intersection3D(position + path * direction, path,
+                         intersections.status[index]),
+          m_surfaces[index]};
+}
@@ -47,6 +47,12 @@ ActsExamples::HitSmearing::HitSmearing(const Config& cfg,
   if (not m_cfg.randomNumbers) {
     throw std::invalid_argument("Missing random numbers tool");
   }
+
+  declareInput(m_cfg.inputSimHits);
+  declareOutput(m_cfg.outputSourceLinks);
+  declareOutput(m_cfg.outputMeasurements);
+  declareOutput(m_cfg.outputMeasurementParticlesMap);
+  declareOutput(m_cfg.outputMeasurementSimHitsMap);
 }
 
 ActsExamples::ProcessCode ActsExamples::HitSmearing::execute(
@@ -85,6 +85,13 @@ ActsExamples::PlanarSteppingAlgorithm::PlanarSteppingAlgorithm(
     // record all valid surfaces
     this->m_digitizables.insert_or_assign(surface->geometryId(), dg);
   });
+
+  declareInput(m_cfg.inputSimHits);
+  declareOutput(m_cfg.outputClusters);
+  declareOutput(m_cfg.outputSourceLinks);
+  declareOutput(m_cfg.outputMeasurements);
+  declareOutput(m_cfg.outputMeasurementParticlesMap);
+  declareOutput(m_cfg.outputMeasurementSimHitsMap);
 }
 
 ActsExamples::ProcessCode ActsExamples::PlanarSteppingAlgorithm::execute(
@@ -92,6 +92,12 @@ ActsExamples::SmearingAlgorithm::SmearingAlgorithm(
     }
   }
   m_smearers = Acts::GeometryHierarchyMap<Smearer>(std::move(smearersInput));
+
+  declareInput(m_cfg.inputSimHits);
+  declareOutput(m_cfg.outputSourceLinks);
+  declareOutput(m_cfg.outputMeasurements);
+  declareOutput(m_cfg.outputMeasurementParticlesMap);
+  declareOutput(m_cfg.outputMeasurementSimHitsMap);
 }
 
 ActsExamples::ProcessCode ActsExamples::SmearingAlgorithm::execute(
@@ -56,6 +56,11 @@ class FatrasAlgorithm final : public BareAlgorithm {
                << m_cfg.simulator.charged.selectHitSurface.material);
     ACTS_DEBUG("hits on passive surfaces: "
                << m_cfg.simulator.charged.selectHitSurface.passive);
+
+    declareInput(m_cfg.inputParticles);
+    declareOutput(m_cfg.outputParticlesInitial);
+    declareOutput(m_cfg.outputParticlesFinal);
+    declareOutput(m_cfg.outputSimHits);
   }
 
   /// Run the simulation for a single event.
@@ -17,6 +17,7 @@
 #include <climits>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 namespace Acts {
 
@@ -48,8 +49,9 @@ namespace ActsExamples {
 /// However, running it in one single event, puts enormous pressure onto
 /// the I/O structure.
 ///
-/// It therefore saves the mapping state/cache as a private member variable
-/// and is designed to be executed in a single threaded mode.
+/// It therefore keeps the mapping states as private member variables. Each
+/// concurrently processed event uses its own state and the states are merged
+/// at the end of the run, i.e. the algorithm can be executed multi-threaded.
 class MaterialMapping : public ActsExamples::BareAlgorithm {
  public:
   /// @class nested Config class
@@ -93,22 +95,36 @@ class MaterialMapping : public ActsExamples::BareAlgorithm {
   MaterialMapping(const Config& cfg,
                   Acts::Logging::Level level = Acts::Logging::INFO);
 
-  /// Destructor
-  /// - it also writes out the file
-  ~MaterialMapping();
-
   /// Framework execute method
   ///
   /// @param context The algorithm context for event consistency
   ActsExamples::ProcessCode execute(
       const AlgorithmContext& context) const final override;
 
+  /// Merge the mapping states, finalize the maps and write them out
+  ActsExamples::ProcessCode finalize() final override;
+
  private:
+  /// The mapping states used by one event at a time
+  struct MappingState {
+    MappingState(const Acts::GeometryContext& gctx,
+                 const Acts::MagneticFieldContext& mctx)
+        : surface(gctx, mctx), volume(gctx, mctx) {}
+
+    Acts::SurfaceMaterialMapper::State surface;
+    Acts::VolumeMaterialMapper::State volume;
+  };
+
+  /// Create a mapping state for the configured mappers
+  std::unique_ptr<MappingState> createMappingState() const;
+
   Config m_cfg;  //!< internal config object
-  Acts::SurfaceMaterialMapper::State
-      m_mappingState;  //!< Material mapping state
-  Acts::VolumeMaterialMapper::State
-      m_mappingStateVol;  //!< Material mapping state
+  /// All mapping states, one per concurrently processed event
+  mutable std::vector<std::unique_ptr<MappingState>> m_mappingStates;
+  /// The mapping states that are currently not in use
+  mutable std::vector<MappingState*> m_freeMappingStates;
+  /// Protects the mapping state bookkeeping, not the states themselves
+  mutable std::mutex m_mappingStateMutex;
 };
 
 }  // namespace ActsExamples
@@ -10,74 +10,97 @@
 
 #include "ActsExamples/Framework/WhiteBoard.hpp"
 
+#include <exception>
 #include <iostream>
 #include <stdexcept>
 
 ActsExamples::MaterialMapping::MaterialMapping(
     const ActsExamples::MaterialMapping::Config& cnf,
     Acts::Logging::Level level)
-    : ActsExamples::BareAlgorithm("MaterialMapping", level),
-      m_cfg(cnf),
-      m_mappingState(cnf.geoContext, cnf.magFieldContext),
-      m_mappingStateVol(cnf.geoContext, cnf.magFieldContext) {
+    : ActsExamples::BareAlgorithm("MaterialMapping", level), m_cfg(cnf) {
   if (!m_cfg.materialSurfaceMapper && !m_cfg.materialVolumeMapper) {
     throw std::invalid_argument("Missing material mapper");
   } else if (!m_cfg.trackingGeometry) {
     throw std::invalid_argument("Missing tracking geometry");
   }
 
-  ACTS_INFO("This algorithm requires inter-event information, "
-            << "run in single-threaded mode!");
+  // Generate the first state, further ones are created on demand
+  m_mappingStates.push_back(createMappingState());
+  m_freeMappingStates.push_back(m_mappingStates.back().get());
+}
 
+std::unique_ptr<ActsExamples::MaterialMapping::MappingState>
+ActsExamples::MaterialMapping::createMappingState() const {
+  auto state =
+      std::make_unique<MappingState>(m_cfg.geoContext, m_cfg.magFieldContext);
   if (m_cfg.materialSurfaceMapper) {
-    // Generate and retrieve the central cache object
-    m_mappingState = m_cfg.materialSurfaceMapper->createState(
+    state->surface = m_cfg.materialSurfaceMapper->createState(
         m_cfg.geoContext, m_cfg.magFieldContext, *m_cfg.trackingGeometry);
   }
   if (m_cfg.materialVolumeMapper) {
-    // Generate and retrieve the central cache object
-    m_mappingStateVol = m_cfg.materialVolumeMapper->createState(
+    state->volume = m_cfg.materialVolumeMapper->createState(
         m_cfg.geoContext, m_cfg.magFieldContext, *m_cfg.trackingGeometry);
   }
+  return state;
 }
 
-ActsExamples::MaterialMapping::~MaterialMapping() {
+ActsExamples::ProcessCode ActsExamples::MaterialMapping::finalize() {
   Acts::DetectorMaterialMaps detectorMaterial;
 
+  // Merge the states of all concurrently processed events
+  ACTS_DEBUG("Merging " << m_mappingStates.size() << " mapping states");
+  auto& mappingState = m_mappingStates.front()->surface;
+  auto& mappingStateVol = m_mappingStates.front()->volume;
+  try {
+    for (size_t i = 1; i < m_mappingStates.size(); ++i) {
+      if (m_cfg.materialSurfaceMapper) {
+        m_cfg.materialSurfaceMapper->mergeStates(
+            mappingState, std::move(m_mappingStates[i]->surface));
+      }
+      if (m_cfg.materialVolumeMapper) {
+        m_cfg.materialVolumeMapper->mergeStates(
+            mappingStateVol, std::move(m_mappingStates[i]->volume));
+      }
+    }
+  } catch (const std::exception& e) {
+    ACTS_ERROR("Merging the mapping states failed: " << e.what());
+    return ActsExamples::ProcessCode::ABORT;
+  }
+
   if (m_cfg.materialSurfaceMapper && m_cfg.materialVolumeMapper) {
     // Finalize all the maps using the cached state
-    m_cfg.materialSurfaceMapper->finalizeMaps(m_mappingState);
-    m_cfg.materialVolumeMapper->finalizeMaps(m_mappingStateVol);
+    m_cfg.materialSurfaceMapper->finalizeMaps(mappingState);
+    m_cfg.materialVolumeMapper->finalizeMaps(mappingStateVol);
     // Loop over the state, and collect the maps for surfaces
-    for (auto& [key, value] : m_mappingState.surfaceMaterial) {
+    for (auto& [key, value] : mappingState.surfaceMaterial) {
       detectorMaterial.first.insert({key, std::move(value)});
     }
     // Loop over the state, and collect the maps for volumes
-    for (auto& [key, value] : m_mappingStateVol.volumeMaterial) {
+    for (auto& [key, value] : mappingStateVol.volumeMaterial) {
       detectorMaterial.second.insert({key, std::move(value)});
     }
   } else {
     if (m_cfg.materialSurfaceMapper) {
       // Finalize all the maps using the cached state
-      m_cfg.materialSurfaceMapper->finalizeMaps(m_mappingState);
+      m_cfg.materialSurfaceMapper->finalizeMaps(mappingState);
       // Loop over the state, and collect the maps for surfaces
-      for (auto& [key, value] : m_mappingState.surfaceMaterial) {
+      for (auto& [key, value] : mappingState.surfaceMaterial) {
         detectorMaterial.first.insert({key, std::move(value)});
       }
       // Loop over the state, and collect the maps for volumes
-      for (auto& [key, value] : m_mappingState.volumeMaterial) {
+      for (auto& [key, value] : mappingState.volumeMaterial) {
         detectorMaterial.second.insert({key, std::move(value)});
       }
     }
     if (m_cfg.materialVolumeMapper) {
       // Finalize all the maps using the cached state
-      m_cfg.materialVolumeMapper->finalizeMaps(m_mappingStateVol);
+      m_cfg.materialVolumeMapper->finalizeMaps(mappingStateVol);
       // Loop over the state, and collect the maps for surfaces
-      for (auto& [key, value] : m_mappingStateVol.surfaceMaterial) {
+      for (auto& [key, value] : mappingStateVol.surfaceMaterial) {
         detectorMaterial.first.insert({key, std::move(value)});
       }
       // Loop over the state, and collect the maps for volumes
-      for (auto& [key, value] : m_mappingStateVol.volumeMaterial) {
+      for (auto& [key, value] : mappingStateVol.volumeMaterial) {
         detectorMaterial.second.insert({key, std::move(value)});
       }
     }
@@ -86,6 +109,7 @@ ActsExamples::MaterialMapping::~MaterialMapping() {
   for (auto& imw : m_cfg.materialWriters) {
     imw->writeMaterial(detectorMaterial);
   }
+  return ActsExamples::ProcessCode::SUCCESS;
 }
 
 ActsExamples::ProcessCode ActsExamples::MaterialMapping::execute(
@@ -95,28 +119,41 @@ ActsExamples::ProcessCode ActsExamples::MaterialMapping::execute(
       context.eventStore.get<std::vector<Acts::RecordedMaterialTrack>>(
           m_cfg.collection);
 
-  if (m_cfg.materialSurfaceMapper) {
-    // To make it work with the framework needs a lock guard
-    auto mappingState =
-        const_cast<Acts::SurfaceMaterialMapper::State*>(&m_mappingState);
+  // Take a free mapping state or create a new one
+  MappingState* mappingState = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(m_mappingStateMutex);
+    if (m_freeMappingStates.empty()) {
+      m_mappingStates.push_back(createMappingState());
+      m_freeMappingStates.push_back(m_mappingStates.back().get());
+    }
+    mappingState = m_freeMappingStates.back();
+    m_freeMappingStates.pop_back();
+  }
 
+  if (m_cfg.materialSurfaceMapper) {
     for (auto& mTrack : mtrackCollection) {
       // Map this one onto the geometry
-      m_cfg.materialSurfaceMapper->mapMaterialTrack(*mappingState, mTrack);
+      m_cfg.materialSurfaceMapper->mapMaterialTrack(mappingState->surface,
+                                                    mTrack);
     }
   }
   if (m_cfg.materialVolumeMapper) {
-    // To make it work with the framework needs a lock guard
-    auto mappingState =
-        const_cast<Acts::VolumeMaterialMapper::State*>(&m_mappingStateVol);
-
     for (auto& mTrack : mtrackCollection) {
       // Map this one onto the geometry
-      m_cfg.materialVolumeMapper->mapMaterialTrack(*mappingState, mTrack);
+      m_cfg.materialVolumeMapper->mapMaterialTrack(mappingState->volume,
+                                                   mTrack);
     }
   }
+
+  // Give the mapping state back for the next event
+  {
+    std::lock_guard<std::mutex> lock(m_mappingStateMutex);
+    m_freeMappingStates.push_back(mappingState);
+  }
+
   // Write take the collection to the EventStore
   context.eventStore.add(m_cfg.mappingMaterialCollection,
                          std::move(mtrackCollection));
   return ActsExamples::ProcessCode::SUCCESS;
-}
\ No newline at end of file
+}
@@ -49,6 +49,10 @@ class SeedingAlgorithm final : public BareAlgorithm {
     float beamPosX = 0;
     float beamPosY = 0;
     float impactMax = 3.;
+    /// Use the structure-of-arrays seed finding backend.
+    bool useSoABackend = false;
+    /// Process the space point groups of one event in parallel.
+    bool parallelGroups = false;
   };
 
   /// Construct the seeding algorithm.
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "Acts/EventData/SourceLinkIndex.hpp"
 #include "Acts/Geometry/TrackingGeometry.hpp"
 #include "Acts/TrackFinding/CombinatorialKalmanFilter.hpp"
 #include "Acts/TrackFinding/MeasurementSelector.hpp"
@@ -30,9 +31,14 @@ class TrackFindingAlgorithm final : public BareAlgorithm {
                                              Acts::MeasurementSelector>;
   using TrackFinderResult = std::vector<
       Acts::Result<Acts::CombinatorialKalmanFilterResult<IndexSourceLink>>>;
+  /// Distributes independent seeds, see Acts::SequentialExecutor. An empty
+  /// executor processes all seeds sequentially on the calling thread.
+  using TrackFinderExecutor = std::function<void(
+      size_t, const std::function<void(size_t, size_t)>&)>;
   using TrackFinderFunction = std::function<TrackFinderResult(
-      const IndexSourceLinkContainer&, const TrackParametersContainer&,
-      const TrackFinderOptions&)>;
+      const Acts::SourceLinkIndex<IndexSourceLink>&,
+      const TrackParametersContainer&, const TrackFinderOptions&,
+      const TrackFinderExecutor&)>;
 
   /// Create the track finder function implementation.
   ///
@@ -55,6 +61,8 @@ class TrackFindingAlgorithm final : public BareAlgorithm {
     TrackFinderFunction findTracks;
     /// CKF measurement selector config
     Acts::MeasurementSelector::Config measurementSelectorCfg;
+    /// Process the seeds of one event in parallel.
+    bool parallelSeeds = false;
   };
 
   /// Constructor of the track finding algorithm
@@ -17,8 +17,11 @@
 #include "ActsExamples/EventData/ProtoTrack.hpp"
 #include "ActsExamples/Framework/WhiteBoard.hpp"
 
+#include <functional>
 #include <stdexcept>
 
+#include <tbb/tbb.h>
+
 ActsExamples::SeedingAlgorithm::SeedingAlgorithm(
     ActsExamples::SeedingAlgorithm::Config cfg, Acts::Logging::Level lvl)
     : ActsExamples::BareAlgorithm("SeedingAlgorithm", lvl),
@@ -67,6 +70,13 @@ ActsExamples::SeedingAlgorithm::SeedingAlgorithm(
   m_finderCfg.bFieldInZ = m_cfg.bFieldInZ;
   m_finderCfg.beamPos = Acts::Vector2(m_cfg.beamPosX, m_cfg.beamPosY);
   m_finderCfg.impactMax = m_cfg.impactMax;
+  m_finderCfg.useSoABackend = m_cfg.useSoABackend;
+
+  for (const auto& spacePoints : m_cfg.inputSpacePoints) {
+    declareInput(spacePoints);
+  }
+  declareOutput(m_cfg.outputSeeds);
+  declareOutput(m_cfg.outputProtoTracks);
 }
 
 ActsExamples::ProcessCode ActsExamples::SeedingAlgorithm::execute(
@@ -107,11 +117,26 @@ ActsExamples::ProcessCode ActsExamples::SeedingAlgorithm::execute(
 
   // run the seeding
   std::vector<std::vector<Acts::Seed<SimSpacePoint>>> seeds;
-  auto group = spacePointsGrouping.begin();
-  auto groupEnd = spacePointsGrouping.end();
-  for (; !(group == groupEnd); ++group) {
-    seeds.push_back(finder.createSeedsForGroup(group.bottom(), group.middle(),
-                                               group.top()));
+  if (m_cfg.parallelGroups) {
+    // the groups are independent; seeds are still returned in group order
+    auto executor = [](size_t nGroups,
+                       const std::function<void(size_t, size_t)>& task) {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, nGroups),
+                        [&](const tbb::blocked_range<size_t>& range) {
+                          task(range.begin(), range.end());
+                        });
+    };
+    seeds = finder.createSeedsForGroups(spacePointsGrouping, executor);
+  } else {
+    // the scratch state is shared by all groups of this event
+    Acts::Seedfinder<SimSpacePoint>::State state;
+    auto group = spacePointsGrouping.begin();
+    auto groupEnd = spacePointsGrouping.end();
+    for (; !(group == groupEnd); ++group) {
+      seeds.emplace_back();
+      finder.createSeedsForGroup(state, seeds.back(), group.bottom(),
+                                 group.middle(), group.top());
+    }
   }
 
   // extract proto tracks, i.e. groups of measurement indices, from tracks seeds
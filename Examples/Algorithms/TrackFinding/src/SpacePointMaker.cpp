@@ -81,6 +81,10 @@ ActsExamples::SpacePointMaker::SpacePointMaker(Config cfg,
   for (const auto& geoId : m_cfg.geometrySelection) {
     ACTS_INFO("  " << geoId);
   }
+
+  declareInput(m_cfg.inputSourceLinks);
+  declareInput(m_cfg.inputMeasurements);
+  declareOutput(m_cfg.outputSpacePoints);
 }
 
 ActsExamples::ProcessCode ActsExamples::SpacePointMaker::execute(
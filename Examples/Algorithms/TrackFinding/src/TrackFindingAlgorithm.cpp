@@ -13,8 +13,11 @@
 #include "ActsExamples/EventData/Trajectories.hpp"
 #include "ActsExamples/Framework/WhiteBoard.hpp"
 
+#include <functional>
 #include <stdexcept>
 
+#include <tbb/tbb.h>
+
 ActsExamples::TrackFindingAlgorithm::TrackFindingAlgorithm(
     Config cfg, Acts::Logging::Level level)
     : ActsExamples::BareAlgorithm("TrackFindingAlgorithm", level),
@@ -32,6 +35,11 @@ ActsExamples::TrackFindingAlgorithm::TrackFindingAlgorithm(
   if (m_cfg.outputTrajectories.empty()) {
     throw std::invalid_argument("Missing trajectories output collection");
   }
+
+  declareInput(m_cfg.inputMeasurements);
+  declareInput(m_cfg.inputSourceLinks);
+  declareInput(m_cfg.inputInitialTrackParameters);
+  declareOutput(m_cfg.outputTrajectories);
 }
 
 ActsExamples::ProcessCode ActsExamples::TrackFindingAlgorithm::execute(
@@ -65,14 +73,29 @@ ActsExamples::ProcessCode ActsExamples::TrackFindingAlgorithm::execute(
   // Perform the track finding for all initial parameters
   ACTS_DEBUG("Invoke track finding with " << initialParameters.size()
                                           << " seeds.");
-  auto results = m_cfg.findTracks(sourceLinks, initialParameters, options);
+  TrackFinderExecutor executor;
+  if (m_cfg.parallelSeeds) {
+    // the seeds are independent; results are still returned in seed order
+    executor = [](size_t nSeeds,
+                  const std::function<void(size_t, size_t)>& task) {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, nSeeds),
+                        [&](const tbb::blocked_range<size_t>& range) {
+                          task(range.begin(), range.end());
+                        });
+    };
+  }
+  // the source links are already sorted by surface, i.e. the index is built
+  // without sorting and shared by all seeds
+  const Acts::SourceLinkIndex<IndexSourceLink> sourceLinkIndex(sourceLinks);
+  auto results = m_cfg.findTracks(sourceLinkIndex, initialParameters, options,
+                                  executor);
   // Loop over the track finding results for all initial parameters
   for (std::size_t iseed = 0; iseed < initialParameters.size(); ++iseed) {
     // The result for this seed
     auto& result = results[iseed];
     if (result.ok()) {
       // Get the track finding output object
-      const auto& trackFindingOutput = result.value();
+      auto& trackFindingOutput = result.value();
       // Create a Trajectories result struct
       trajectories.emplace_back(std::move(trackFindingOutput.fittedStates),
                                 std::move(trackFindingOutput.trackTips),
@@ -29,10 +29,15 @@ struct TrackFinderFunctionImpl {
   TrackFinderFunctionImpl(track_finder_t&& f) : trackFinder(std::move(f)) {}
 
   ActsExamples::TrackFindingAlgorithm::TrackFinderResult operator()(
-      const ActsExamples::IndexSourceLinkContainer& sourcelinks,
+      const Acts::SourceLinkIndex<ActsExamples::IndexSourceLink>& sourcelinks,
       const ActsExamples::TrackParametersContainer& initialParameters,
-      const ActsExamples::TrackFindingAlgorithm::TrackFinderOptions& options)
+      const ActsExamples::TrackFindingAlgorithm::TrackFinderOptions& options,
+      const ActsExamples::TrackFindingAlgorithm::TrackFinderExecutor& executor)
       const {
+    if (executor) {
+      return trackFinder.findTracks(sourcelinks, initialParameters, options,
+                                    executor);
+    }
     return trackFinder.findTracks(sourcelinks, initialParameters, options);
   };
 };
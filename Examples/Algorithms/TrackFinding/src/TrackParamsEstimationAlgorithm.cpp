@@ -53,6 +53,11 @@ ActsExamples::TrackParamsEstimationAlgorithm::TrackParamsEstimationAlgorithm(
       cfg.sigmaQOverP * m_cfg.sigmaQOverP;
   m_covariance(Acts::eBoundTime, Acts::eBoundTime) =
       m_cfg.sigmaT0 * m_cfg.sigmaT0;
+
+  declareInput(m_cfg.inputSeeds);
+  declareInput(m_cfg.inputSourceLinks);
+  declareOutput(m_cfg.outputTrackParameters);
+  declareOutput(m_cfg.outputTrackParametersSeedMap);
 }
 
 ActsExamples::ProcessCode ActsExamples::TrackParamsEstimationAlgorithm::execute(
@@ -28,6 +28,11 @@ ActsExamples::SurfaceSortingAlgorithm::SurfaceSortingAlgorithm(
   if (m_cfg.outputProtoTracks.empty()) {
     throw std::invalid_argument("Missing output proto track collection");
   }
+
+  declareInput(m_cfg.inputProtoTracks);
+  declareInput(m_cfg.inputSimulatedHits);
+  declareInput(m_cfg.inputMeasurementSimHitsMap);
+  declareOutput(m_cfg.outputProtoTracks);
 }
 
 ActsExamples::ProcessCode ActsExamples::SurfaceSortingAlgorithm::execute(
@@ -97,6 +97,11 @@ ActsExamples::ParticleSelector::ParticleSelector(const Config& cfg,
                                        << ")");
   ACTS_DEBUG("remove charged particles " << m_cfg.removeCharged);
   ACTS_DEBUG("remove neutral particles " << m_cfg.removeNeutral);
+
+  m_inputParticles = DataHandle<SimParticleContainer>(m_cfg.inputParticles);
+  m_outputParticles = DataHandle<SimParticleContainer>(m_cfg.outputParticles);
+  declareInput(m_cfg.inputParticles);
+  declareOutput(m_cfg.outputParticles);
 }
 
 ActsExamples::ProcessCode ActsExamples::ParticleSelector::execute(
@@ -125,8 +130,7 @@ ActsExamples::ProcessCode ActsExamples::ParticleSelector::execute(
   };
 
   // prepare input/ output types
-  const auto& inputParticles =
-      ctx.eventStore.get<SimParticleContainer>(m_cfg.inputParticles);
+  const auto& inputParticles = ctx.eventStore.get(m_inputParticles);
   SimParticleContainer outputParticles;
   outputParticles.reserve(inputParticles.size());
 
@@ -143,6 +147,6 @@ ActsExamples::ProcessCode ActsExamples::ParticleSelector::execute(
                       << outputParticles.size() << " from "
                       << inputParticles.size() << " particles");
 
-  ctx.eventStore.add(m_cfg.outputParticles, std::move(outputParticles));
+  ctx.eventStore.add(m_outputParticles, std::move(outputParticles));
   return ProcessCode::SUCCESS;
 }
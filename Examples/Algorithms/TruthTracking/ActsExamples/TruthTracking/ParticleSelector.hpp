@@ -12,7 +12,9 @@
 
 #pragma once
 
+#include "ActsExamples/EventData/SimParticle.hpp"
 #include "ActsExamples/Framework/BareAlgorithm.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Utilities/OptionsFwd.hpp"
 
 #include <limits>
@@ -63,6 +65,8 @@ class ParticleSelector final : public BareAlgorithm {
 
  private:
   Config m_cfg;
+  DataHandle<SimParticleContainer> m_inputParticles;
+  DataHandle<SimParticleContainer> m_outputParticles;
 };
 
 }  // namespace ActsExamples
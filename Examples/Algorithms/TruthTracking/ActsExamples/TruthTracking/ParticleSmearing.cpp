@@ -27,13 +27,18 @@ ActsExamples::ParticleSmearing::ParticleSmearing(const Config& cfg,
   if (m_cfg.outputTrackParameters.empty()) {
     throw std::invalid_argument("Missing output tracks parameters collection");
   }
+
+  m_inputParticles = DataHandle<SimParticleContainer>(m_cfg.inputParticles);
+  m_outputTrackParameters =
+      DataHandle<TrackParametersContainer>(m_cfg.outputTrackParameters);
+  declareInput(m_cfg.inputParticles);
+  declareOutput(m_cfg.outputTrackParameters);
 }
 
 ActsExamples::ProcessCode ActsExamples::ParticleSmearing::execute(
     const AlgorithmContext& ctx) const {
   // setup input and output containers
-  const auto& particles =
-      ctx.eventStore.get<SimParticleContainer>(m_cfg.inputParticles);
+  const auto& particles = ctx.eventStore.get(m_inputParticles);
   TrackParametersContainer parameters;
   parameters.reserve(particles.size());
 
@@ -98,6 +103,6 @@ ActsExamples::ProcessCode ActsExamples::ParticleSmearing::execute(
     }
   }
 
-  ctx.eventStore.add(m_cfg.outputTrackParameters, std::move(parameters));
+  ctx.eventStore.add(m_outputTrackParameters, std::move(parameters));
   return ProcessCode::SUCCESS;
 }
@@ -9,7 +9,10 @@
 #pragma once
 
 #include "Acts/Definitions/Units.hpp"
+#include "ActsExamples/EventData/SimParticle.hpp"
+#include "ActsExamples/EventData/Track.hpp"
 #include "ActsExamples/Framework/BareAlgorithm.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/RandomNumbers.hpp"
 
 #include <limits>
@@ -58,6 +61,8 @@ class ParticleSmearing final : public BareAlgorithm {
 
  private:
   Config m_cfg;
+  DataHandle<SimParticleContainer> m_inputParticles;
+  DataHandle<TrackParametersContainer> m_outputTrackParameters;
 };
 
 }  // namespace ActsExamples
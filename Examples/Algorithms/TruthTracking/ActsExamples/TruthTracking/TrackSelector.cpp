@@ -28,6 +28,10 @@ ActsExamples::TrackSelector::TrackSelector(const Config& cfg,
   if (m_cfg.outputTrackIndices.empty()) {
     throw std::invalid_argument("Missing output track indices collection");
   }
+
+  declareInput(m_cfg.inputTrackParameters);
+  declareOutput(m_cfg.outputTrackParameters);
+  declareOutput(m_cfg.outputTrackIndices);
 }
 
 ActsExamples::ProcessCode ActsExamples::TrackSelector::execute(
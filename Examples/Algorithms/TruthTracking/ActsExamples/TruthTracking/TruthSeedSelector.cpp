@@ -32,6 +32,10 @@ TruthSeedSelector::TruthSeedSelector(const Config& cfg,
   if (m_cfg.outputParticles.empty()) {
     throw std::invalid_argument("Missing output truth particles collection");
   }
+
+  declareInput(m_cfg.inputParticles);
+  declareInput(m_cfg.inputMeasurementParticlesMap);
+  declareOutput(m_cfg.outputParticles);
 }
 
 ProcessCode TruthSeedSelector::execute(const AlgorithmContext& ctx) const {
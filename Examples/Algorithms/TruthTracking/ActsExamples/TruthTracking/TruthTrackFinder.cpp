@@ -31,6 +31,10 @@ TruthTrackFinder::TruthTrackFinder(const Config& cfg, Acts::Logging::Level lvl)
   if (m_cfg.outputProtoTracks.empty()) {
     throw std::invalid_argument("Missing output proto tracks collection");
   }
+
+  declareInput(m_cfg.inputParticles);
+  declareInput(m_cfg.inputMeasurementParticlesMap);
+  declareOutput(m_cfg.outputProtoTracks);
 }
 
 ProcessCode TruthTrackFinder::execute(const AlgorithmContext& ctx) const {
@@ -26,6 +26,9 @@ ActsExamples::TruthVertexFinder::TruthVertexFinder(const Config& cfg,
   if (m_cfg.outputProtoVertices.empty()) {
     throw std::invalid_argument("Missing output proto vertices collection");
   }
+
+  declareInput(m_cfg.inputParticles);
+  declareOutput(m_cfg.outputProtoVertices);
 }
 
 ActsExamples::ProcessCode ActsExamples::TruthVertexFinder::execute(
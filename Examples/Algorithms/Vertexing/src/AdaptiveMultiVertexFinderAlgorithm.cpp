@@ -42,6 +42,9 @@ ActsExamples::AdaptiveMultiVertexFinderAlgorithm::
   if (m_cfg.outputProtoVertices.empty()) {
     throw std::invalid_argument("Missing output proto vertices collection");
   }
+
+  declareInput(m_cfg.inputTrackParameters);
+  declareOutput(m_cfg.outputProtoVertices);
 }
 
 ActsExamples::ProcessCode
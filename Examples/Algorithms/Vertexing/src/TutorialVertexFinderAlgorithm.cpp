@@ -37,6 +37,8 @@ ActsExamples::TutorialVertexFinderAlgorithm::TutorialVertexFinderAlgorithm(
   if (m_cfg.outputProtoVertices.empty()) {
     throw std::invalid_argument("Missing output proto vertices collection");
   }
+
+  declareInput(m_cfg.inputTrackParameters);
 }
 
 ActsExamples::ProcessCode ActsExamples::TutorialVertexFinderAlgorithm::execute(
@@ -34,6 +34,9 @@ ActsExamples::VertexFitterAlgorithm::VertexFitterAlgorithm(
   if (m_cfg.inputProtoVertices.empty()) {
     throw std::invalid_argument("Missing input proto vertices collection");
   }
+
+  declareInput(m_cfg.inputTrackParameters);
+  declareInput(m_cfg.inputProtoVertices);
 }
 
 ActsExamples::ProcessCode ActsExamples::VertexFitterAlgorithm::execute(
@@ -13,6 +13,7 @@
 #include "ActsExamples/EventData/Track.hpp"
 
 #include <algorithm>
+#include <memory>
 #include <unordered_map>
 #include <vector>
 
@@ -24,7 +25,9 @@ namespace ActsExamples {
 /// individual trajectories, and a map of fitted parameters indexed by the
 /// entry index. In case of track fitting, there is at most one trajectory
 /// in the MultiTrajectory; In case of track finding, there could be
-/// multiple trajectories in the MultiTrajectory.
+/// multiple trajectories in the MultiTrajectory. The MultiTrajectory can be
+/// shared, e.g. track finding stores the tracks of all seeds of an event in
+/// the same MultiTrajectory.
 struct Trajectories final {
  public:
   /// (Reconstructed) trajectory with multiple states.
@@ -34,24 +37,34 @@ struct Trajectories final {
 
   /// Default construct an empty object. Required for container compatibility
   /// and to signal an error.
-  Trajectories() = default;
+  Trajectories() : m_multiTrajectory(std::make_shared<MultiTrajectory>()) {}
   /// Construct from fitted multi trajectory and parameters.
   ///
   /// @param multiTraj The multi trajectory
   /// @param tTips Tip indices that identify valid trajectories
   /// @param parameters Fitted track parameters indexed by trajectory index
-  Trajectories(const MultiTrajectory& multiTraj,
-               const std::vector<size_t>& tTips,
-               const IndexedParameters& parameters)
-      : m_multiTrajectory(multiTraj),
-        m_trackTips(tTips),
-        m_trackParameters(parameters) {}
+  Trajectories(MultiTrajectory multiTraj, std::vector<size_t> tTips,
+               IndexedParameters parameters)
+      : m_multiTrajectory(
+            std::make_shared<MultiTrajectory>(std::move(multiTraj))),
+        m_trackTips(std::move(tTips)),
+        m_trackParameters(std::move(parameters)) {}
+  /// Construct from a shared multi trajectory and parameters.
+  ///
+  /// @param multiTraj The multi trajectory, possibly shared with others
+  /// @param tTips Tip indices that identify valid trajectories
+  /// @param parameters Fitted track parameters indexed by trajectory index
+  Trajectories(std::shared_ptr<const MultiTrajectory> multiTraj,
+               std::vector<size_t> tTips, IndexedParameters parameters)
+      : m_multiTrajectory(std::move(multiTraj)),
+        m_trackTips(std::move(tTips)),
+        m_trackParameters(std::move(parameters)) {}
 
   /// Return true if there exists no valid trajectory.
   bool empty() const { return m_trackTips.empty(); }
 
   /// Access the underlying multi trajectory.
-  const MultiTrajectory& multiTrajectory() const { return m_multiTrajectory; }
+  const MultiTrajectory& multiTrajectory() const { return *m_multiTrajectory; }
 
   /// Access the tip indices that identify valid trajectories.
   const std::vector<size_t>& tips() const { return m_trackTips; }
@@ -87,8 +100,8 @@ struct Trajectories final {
   }
 
  private:
-  // The multiTrajectory
-  MultiTrajectory m_multiTrajectory;
+  // The multiTrajectory, possibly shared with other trajectories
+  std::shared_ptr<const MultiTrajectory> m_multiTrajectory;
   // The entry indices of trajectories stored in multiTrajectory
   std::vector<size_t> m_trackTips = {};
   // The fitted parameters at the provided surface for individual trajectories
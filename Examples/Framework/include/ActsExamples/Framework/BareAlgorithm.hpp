@@ -20,6 +20,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace ActsExamples {
 
@@ -46,12 +47,27 @@ class BareAlgorithm : public IAlgorithm {
   virtual ProcessCode execute(
       const AlgorithmContext& context) const override = 0;
 
+  /// Names of the event store objects declared as inputs.
+  std::vector<std::string> inputs() const final override;
+  /// Names of the event store objects declared as outputs.
+  std::vector<std::string> outputs() const final override;
+
  protected:
   const Acts::Logger& logger() const { return *m_logger; }
 
+  /// Declare an event store object read in `execute`.
+  ///
+  /// Should be called in the constructor of the subclass. Empty names, e.g.
+  /// for unused optional inputs, are ignored.
+  void declareInput(const std::string& name);
+  /// Declare an event store object written in `execute`.
+  void declareOutput(const std::string& name);
+
  private:
   std::string m_name;
   std::unique_ptr<const Acts::Logger> m_logger;
+  std::vector<std::string> m_inputs;
+  std::vector<std::string> m_outputs;
 };
 
 }  // namespace ActsExamples
@@ -0,0 +1,62 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+namespace ActsExamples {
+
+namespace detail {
+/// Resolve an object name to its process-wide white board slot.
+///
+/// Slots are assigned on first use and never change afterwards. This function
+/// is thread-safe; resolving an already known name only takes a shared lock.
+size_t resolveWhiteBoardSlot(const std::string& name);
+}  // namespace detail
+
+/// Typed key for an object on the white board.
+///
+/// The name is resolved to a white board slot once on construction, e.g. in
+/// an algorithm constructor, which allows O(1) access to the object in every
+/// event without hashing the name.
+///
+/// @tparam T Type of the stored object
+template <typename T>
+class DataHandle {
+ public:
+  using value_type = T;
+
+  /// Construct an unset handle. It can not be used to access objects.
+  DataHandle() = default;
+  /// Construct a handle for the object with the given name.
+  ///
+  /// @param name Identifier of the object; an empty name gives an unset handle
+  explicit DataHandle(std::string name)
+      : m_name(std::move(name)),
+        m_slot(m_name.empty() ? kUnset
+                              : detail::resolveWhiteBoardSlot(m_name)) {}
+
+  /// Name of the object.
+  const std::string& name() const { return m_name; }
+  /// White board slot of the object.
+  size_t slot() const { return m_slot; }
+  /// Whether the handle refers to an object.
+  bool isSet() const { return m_slot != kUnset; }
+
+ private:
+  static constexpr size_t kUnset = SIZE_MAX;
+
+  std::string m_name;
+  size_t m_slot = kUnset;
+};
+
+}  // namespace ActsExamples
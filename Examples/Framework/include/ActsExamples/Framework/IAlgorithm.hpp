@@ -12,6 +12,7 @@
 #include "ActsExamples/Framework/ProcessCode.hpp"
 
 #include <string>
+#include <vector>
 
 namespace ActsExamples {
 
@@ -28,6 +29,40 @@ class IAlgorithm {
 
   /// Execute the algorithm for one event.
   virtual ProcessCode execute(const AlgorithmContext& context) const = 0;
+
+  /// Execute the algorithm for multiple events at once.
+  ///
+  /// The contexts belong to consecutive events in event order and each one
+  /// carries the algorithm number for its event. Algorithms can override this
+  /// to amortize per-event overheads, e.g. by running a vectorized kernel over
+  /// the data of all events. By default, the events are executed one after
+  /// the other and the first failure stops the execution.
+  virtual ProcessCode executeBatch(
+      const std::vector<AlgorithmContext>& contexts) const {
+    for (const auto& context : contexts) {
+      ProcessCode code = execute(context);
+      if (code != ProcessCode::SUCCESS) {
+        return code;
+      }
+    }
+    return ProcessCode::SUCCESS;
+  }
+
+  /// Finalize the algorithm once all events have been processed.
+  ///
+  /// Called by the Sequencer after the event loop and before the end-of-run
+  /// hooks of the writers. Algorithms that accumulate data over all events
+  /// produce their final results here, where failures can still be reported.
+  virtual ProcessCode finalize() { return ProcessCode::SUCCESS; }
+
+  /// Names of the event store objects read by the algorithm.
+  ///
+  /// The declared inputs and outputs allow the Sequencer to execute
+  /// independent algorithms concurrently. An algorithm that declares neither
+  /// is assumed to depend on all other algorithms.
+  virtual std::vector<std::string> inputs() const { return {}; }
+  /// Names of the event store objects written by the algorithm.
+  virtual std::vector<std::string> outputs() const { return {}; }
 };
 
 }  // namespace ActsExamples
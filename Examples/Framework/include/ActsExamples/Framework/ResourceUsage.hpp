@@ -0,0 +1,72 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ActsExamples {
+
+/// Resource usage of a code block, e.g. of an algorithm for one event.
+///
+/// All quantities except the peak resident set size are measured for the
+/// executing thread only, i.e. work that is offloaded to other threads is not
+/// included.
+struct ResourceUsage {
+  /// Cpu time of the executing thread in nanoseconds.
+  uint64_t cpuTimeNs = 0;
+  /// Increase of the peak resident set size of the process in kilobytes.
+  int64_t maxRssIncreaseKb = 0;
+  /// Number of allocations; requires the allocation hook library.
+  uint64_t allocations = 0;
+  /// Number of allocated bytes; requires the allocation hook library.
+  uint64_t allocatedBytes = 0;
+  /// Hardware counters; zero if not available.
+  uint64_t cycles = 0;
+  uint64_t instructions = 0;
+  uint64_t cacheMisses = 0;
+
+  ResourceUsage& operator+=(const ResourceUsage& other);
+};
+
+/// Accumulate the resource usage of the calling thread within a block.
+///
+/// Hardware counters are read via the Linux perf_event interface and are
+/// opened lazily once per thread. Allocations are only counted if the
+/// `ActsExamplesFrameworkAllocationHook` library is linked into the
+/// executable or preloaded.
+class ResourceProbe {
+ public:
+  /// @param store Resource usage to which the measurement is added
+  explicit ResourceProbe(ResourceUsage& store);
+  ~ResourceProbe();
+
+  ResourceProbe(const ResourceProbe&) = delete;
+  ResourceProbe& operator=(const ResourceProbe&) = delete;
+
+ private:
+  ResourceUsage& m_store;
+  // cumulative counters at the beginning of the block
+  ResourceUsage m_start;
+};
+
+/// Whether hardware counters can be read on the calling thread.
+bool hardwareCountersAvailable();
+
+/// Whether the allocation hook library is active.
+bool allocationHookActive();
+
+namespace detail {
+/// Count an allocation on the calling thread. Must not allocate.
+void recordAllocation(size_t bytes) noexcept;
+/// Mark the allocation hook as active. Called by the hook library.
+void activateAllocationHook() noexcept;
+}  // namespace detail
+
+}  // namespace ActsExamples
@@ -41,6 +41,35 @@ class Sequencer {
     int numThreads = -1;
     /// output directory for timing information, empty for working directory
     std::string outputDir;
+    /// execute independent algorithms of the same event concurrently
+    ///
+    /// The dependencies are derived from the inputs and outputs declared by
+    /// the algorithms; see IAlgorithm::inputs() and IAlgorithm::outputs().
+    bool parallelAlgorithms = false;
+    /// maximum number of events in flight for pipelined processing, zero to
+    /// disable the pipeline
+    ///
+    /// In pipelined mode, events are processed concurrently but writers are
+    /// called for one event at a time in event order. This yields
+    /// reproducible output files independent of the number of threads.
+    size_t eventsInFlight = 0;
+    /// record the resource usage of every algorithm for every event
+    ///
+    /// The cpu time, the increase of the peak memory, the number of
+    /// allocations, and hardware counters, if available, are written to
+    /// `resources.csv` in the output directory. Allocations are only counted
+    /// if the `ActsExamplesFrameworkAllocationHook` library is linked or
+    /// preloaded.
+    bool instrumentAlgorithms = false;
+    /// number of consecutive events that are processed together
+    ///
+    /// Each step, e.g. a reader or an algorithm, processes all events of a
+    /// batch before the next step is run. Algorithms receive the whole batch
+    /// via IAlgorithm::executeBatch. Writers are still called per event. With
+    /// batches, the recorded resource usage refers to the whole batch and is
+    /// identified by its first event. In pipelined mode, `eventsInFlight`
+    /// is rounded down to full batches but at least one batch is in flight.
+    size_t eventBatchSize = 1;
   };
 
   Sequencer(const Config& cfg);
@@ -91,7 +120,11 @@ class Sequencer {
   ///
   /// This will run the start-of-run hook for all configured services, run all
   /// configured readers, algorithms, and writers for each event, then invoke
-  /// the end-of-run hook for all configured writers.
+  /// the end-of-run hook for all configured writers. Writers are either called
+  /// from the thread that processed the event or, in pipelined mode, from a
+  /// separate serial stage in event order. If enabled, algorithms
+  /// that do not depend on each other are executed concurrently; otherwise
+  /// they are executed in the order they were added.
   int run();
 
  private:
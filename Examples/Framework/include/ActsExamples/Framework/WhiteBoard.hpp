@@ -8,14 +8,16 @@
 
 #pragma once
 
+#include "ActsExamples/Framework/DataHandle.hpp"
 #include <Acts/Utilities/Logger.hpp>
 
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
 #include <typeinfo>
-#include <unordered_map>
 #include <vector>
 
 namespace ActsExamples {
@@ -26,6 +28,13 @@ namespace ActsExamples {
 /// added to it. Once an object has been added, it can only be read but not
 /// be modified. Trying to replace an existing object is considered an error.
 /// Its lifetime is bound to the liftime of the white board.
+///
+/// Objects are stored in slots that are shared by all white boards, see
+/// DataHandle. Accessing an object through a handle avoids hashing its name.
+/// Accessing it by name resolves the handle on every call.
+///
+/// Objects can be added and retrieved concurrently, e.g. by algorithms of the
+/// same event that run in parallel.
 class WhiteBoard {
  public:
   WhiteBoard(std::unique_ptr<const Acts::Logger> logger =
@@ -35,6 +44,13 @@ class WhiteBoard {
   WhiteBoard(const WhiteBoard& other) = delete;
   WhiteBoard& operator=(const WhiteBoard&) = delete;
 
+  /// Store an object on the white board and transfer ownership.
+  ///
+  /// @param handle Handle of the object
+  /// @param object Movable reference to the transferable object
+  /// @throws std::invalid_argument on unset handle or duplicate object
+  template <typename T>
+  void add(const DataHandle<T>& handle, T&& object);
   /// Store an object on the white board and transfer ownership.
   ///
   /// @param name Non-empty identifier to store it under
@@ -43,6 +59,13 @@ class WhiteBoard {
   template <typename T>
   void add(const std::string& name, T&& object);
 
+  /// Get access to a stored object.
+  ///
+  /// @param[in] handle Handle of the object
+  /// @return reference to the stored object
+  /// @throws std::out_of_range if no object of the requested type is stored
+  template <typename T>
+  const T& get(const DataHandle<T>& handle) const;
   /// Get access to a stored object.
   ///
   /// @param[in] name Identifier for the object
@@ -51,6 +74,11 @@ class WhiteBoard {
   template <typename T>
   const T& get(const std::string& name) const;
 
+  /// Remove all objects but keep the slot storage for the next event.
+  ///
+  /// @note Must not be called concurrently with any other access.
+  void clear();
+
  private:
   // type-erased value holder for move-constructible types
   struct IHolder {
@@ -68,7 +96,10 @@ class WhiteBoard {
   };
 
   std::unique_ptr<const Acts::Logger> m_logger;
-  std::unordered_map<std::string, std::unique_ptr<IHolder>> m_store;
+  // indexed by the slot; the holders are never moved, i.e. references to the
+  // stored objects remain valid after the lock is released
+  std::vector<std::unique_ptr<IHolder>> m_store;
+  mutable std::shared_mutex m_storeMutex;
 
   const Acts::Logger& logger() const { return *m_logger; }
 };
@@ -80,27 +111,53 @@ inline ActsExamples::WhiteBoard::WhiteBoard(
     : m_logger(std::move(logger)) {}
 
 template <typename T>
-inline void ActsExamples::WhiteBoard::add(const std::string& name, T&& object) {
-  if (name.empty()) {
+inline void ActsExamples::WhiteBoard::add(const DataHandle<T>& handle,
+                                          T&& object) {
+  if (not handle.isSet()) {
     throw std::invalid_argument("Object can not have an empty name");
   }
-  if (0 < m_store.count(name)) {
-    throw std::invalid_argument("Object '" + name + "' already exists");
+  auto holder = std::make_unique<HolderT<T>>(std::move(object));
+  std::unique_lock lock(m_storeMutex);
+  if (m_store.size() <= handle.slot()) {
+    m_store.resize(handle.slot() + 1);
+  }
+  if (m_store[handle.slot()]) {
+    throw std::invalid_argument("Object '" + handle.name() +
+                                "' already exists");
   }
-  m_store.emplace(name, std::make_unique<HolderT<T>>(std::forward<T>(object)));
-  ACTS_VERBOSE("Added object '" << name << "'");
+  m_store[handle.slot()] = std::move(holder);
+  ACTS_VERBOSE("Added object '" << handle.name() << "'");
 }
 
 template <typename T>
-inline const T& ActsExamples::WhiteBoard::get(const std::string& name) const {
-  auto it = m_store.find(name);
-  if (it == m_store.end()) {
-    throw std::out_of_range("Object '" + name + "' does not exists");
+inline void ActsExamples::WhiteBoard::add(const std::string& name, T&& object) {
+  using Value = std::decay_t<T>;
+  static_assert(std::is_same_v<T, Value>, "Object must be an rvalue");
+  add(DataHandle<Value>(name), std::forward<T>(object));
+}
+
+template <typename T>
+inline const T& ActsExamples::WhiteBoard::get(
+    const DataHandle<T>& handle) const {
+  const IHolder* holder = nullptr;
+  {
+    std::shared_lock lock(m_storeMutex);
+    if (handle.isSet() and handle.slot() < m_store.size()) {
+      holder = m_store[handle.slot()].get();
+    }
+  }
+  if (holder == nullptr) {
+    throw std::out_of_range("Object '" + handle.name() + "' does not exists");
   }
-  const IHolder* holder = it->second.get();
   if (typeid(T) != holder->type()) {
-    throw std::out_of_range("Type missmatch for object '" + name + "'");
+    throw std::out_of_range("Type missmatch for object '" + handle.name() +
+                            "'");
   }
-  ACTS_VERBOSE("Retrieved object '" << name << "'");
-  return reinterpret_cast<const HolderT<T>*>(holder)->value;
+  ACTS_VERBOSE("Retrieved object '" << handle.name() << "'");
+  return static_cast<const HolderT<T>*>(holder)->value;
+}
+
+template <typename T>
+inline const T& ActsExamples::WhiteBoard::get(const std::string& name) const {
+  return get(DataHandle<T>(name));
 }
@@ -16,3 +16,23 @@ ActsExamples::BareAlgorithm::BareAlgorithm(std::string name,
 std::string ActsExamples::BareAlgorithm::name() const {
   return m_name;
 }
+
+std::vector<std::string> ActsExamples::BareAlgorithm::inputs() const {
+  return m_inputs;
+}
+
+std::vector<std::string> ActsExamples::BareAlgorithm::outputs() const {
+  return m_outputs;
+}
+
+void ActsExamples::BareAlgorithm::declareInput(const std::string& name) {
+  if (not name.empty()) {
+    m_inputs.push_back(name);
+  }
+}
+
+void ActsExamples::BareAlgorithm::declareOutput(const std::string& name) {
+  if (not name.empty()) {
+    m_outputs.push_back(name);
+  }
+}
@@ -0,0 +1,166 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Framework/ResourceUsage.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <ctime>
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#endif
+
+namespace {
+
+// allocations counted by the hook for the current thread
+struct AllocationCounters {
+  uint64_t allocations = 0;
+  uint64_t bytes = 0;
+};
+thread_local AllocationCounters t_allocationCounters;
+std::atomic<bool> s_allocationHookActive = false;
+
+// Per-thread group of hardware counters with the cycles counter as leader.
+class HardwareCounters {
+ public:
+  static constexpr size_t kNumCounters = 3;
+
+  HardwareCounters() {
+#if defined(__linux__)
+    const std::array<uint64_t, kNumCounters> configs = {
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_MISSES};
+    for (size_t i = 0; i < kNumCounters; ++i) {
+      perf_event_attr attr;
+      std::memset(&attr, 0, sizeof(attr));
+      attr.size = sizeof(attr);
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = configs[i];
+      attr.read_format = PERF_FORMAT_GROUP;
+      // user space only such that no special privileges are required
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      const int leader = (i == 0) ? -1 : m_fds[0];
+      m_fds[i] = syscall(SYS_perf_event_open, &attr, 0, -1, leader, 0);
+      if (m_fds[i] < 0) {
+        close();
+        return;
+      }
+    }
+#endif
+  }
+  ~HardwareCounters() { close(); }
+
+  bool available() const { return 0 <= m_fds[0]; }
+
+  // read all counters at once; leaves the values untouched on failure
+  void read(uint64_t& cycles, uint64_t& instructions,
+            uint64_t& cacheMisses) const {
+    if (not available()) {
+      return;
+    }
+    // number of counters followed by the counter values
+    std::array<uint64_t, 1 + kNumCounters> buffer = {};
+    if (::read(m_fds[0], buffer.data(), sizeof(buffer)) !=
+        static_cast<ssize_t>(sizeof(buffer))) {
+      return;
+    }
+    cycles = buffer[1];
+    instructions = buffer[2];
+    cacheMisses = buffer[3];
+  }
+
+ private:
+  std::array<int, kNumCounters> m_fds = {-1, -1, -1};
+
+  void close() {
+    for (int& fd : m_fds) {
+      if (0 <= fd) {
+        ::close(fd);
+      }
+      fd = -1;
+    }
+  }
+};
+
+const HardwareCounters& threadHardwareCounters() {
+  thread_local HardwareCounters counters;
+  return counters;
+}
+
+// Cumulative counters of the calling thread.
+ActsExamples::ResourceUsage snapshot() {
+  ActsExamples::ResourceUsage usage;
+
+  timespec cpu;
+  if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu) == 0) {
+    usage.cpuTimeNs = static_cast<uint64_t>(cpu.tv_sec) * 1000000000u +
+                      static_cast<uint64_t>(cpu.tv_nsec);
+  }
+  rusage rus;
+  if (getrusage(RUSAGE_SELF, &rus) == 0) {
+    // in kilobytes on Linux
+    usage.maxRssIncreaseKb = rus.ru_maxrss;
+  }
+  usage.allocations = t_allocationCounters.allocations;
+  usage.allocatedBytes = t_allocationCounters.bytes;
+  threadHardwareCounters().read(usage.cycles, usage.instructions,
+                                usage.cacheMisses);
+  return usage;
+}
+
+}  // namespace
+
+ActsExamples::ResourceUsage& ActsExamples::ResourceUsage::operator+=(
+    const ResourceUsage& other) {
+  cpuTimeNs += other.cpuTimeNs;
+  maxRssIncreaseKb += other.maxRssIncreaseKb;
+  allocations += other.allocations;
+  allocatedBytes += other.allocatedBytes;
+  cycles += other.cycles;
+  instructions += other.instructions;
+  cacheMisses += other.cacheMisses;
+  return *this;
+}
+
+ActsExamples::ResourceProbe::ResourceProbe(ResourceUsage& store)
+    : m_store(store), m_start(snapshot()) {}
+
+ActsExamples::ResourceProbe::~ResourceProbe() {
+  ResourceUsage stop = snapshot();
+  m_store.cpuTimeNs += stop.cpuTimeNs - m_start.cpuTimeNs;
+  m_store.maxRssIncreaseKb += stop.maxRssIncreaseKb - m_start.maxRssIncreaseKb;
+  m_store.allocations += stop.allocations - m_start.allocations;
+  m_store.allocatedBytes += stop.allocatedBytes - m_start.allocatedBytes;
+  m_store.cycles += stop.cycles - m_start.cycles;
+  m_store.instructions += stop.instructions - m_start.instructions;
+  m_store.cacheMisses += stop.cacheMisses - m_start.cacheMisses;
+}
+
+bool ActsExamples::hardwareCountersAvailable() {
+  return threadHardwareCounters().available();
+}
+
+bool ActsExamples::allocationHookActive() {
+  return s_allocationHookActive;
+}
+
+void ActsExamples::detail::recordAllocation(size_t bytes) noexcept {
+  t_allocationCounters.allocations += 1;
+  t_allocationCounters.bytes += bytes;
+}
+
+void ActsExamples::detail::activateAllocationHook() noexcept {
+  s_allocationHookActive = true;
+}
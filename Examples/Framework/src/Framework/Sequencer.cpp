@@ -9,13 +9,17 @@
 #include "ActsExamples/Framework/Sequencer.hpp"
 
 #include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Framework/ResourceUsage.hpp"
 #include "ActsExamples/Framework/WhiteBoard.hpp"
 #include "ActsExamples/Utilities/Paths.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <exception>
+#include <functional>
 #include <numeric>
+#include <optional>
 
 #include <TROOT.h>
 #include <dfe/dfe_io_dsv.hpp>
@@ -210,6 +214,164 @@ struct TimingInfo {
   DFE_NAMEDTUPLE(TimingInfo, identifier, time_total_s, time_perevent_s);
 };
 
+// Store per-event resource usage data
+struct ResourceInfo {
+  uint64_t event_id;
+  std::string identifier;
+  double time_s;
+  double cpu_time_s;
+  int64_t max_rss_increase_kb;
+  uint64_t allocations;
+  uint64_t allocated_bytes;
+  uint64_t cycles;
+  uint64_t instructions;
+  uint64_t cache_misses;
+
+  DFE_NAMEDTUPLE(ResourceInfo, event_id, identifier, time_s, cpu_time_s,
+                 max_rss_increase_kb, allocations, allocated_bytes, cycles,
+                 instructions, cache_misses);
+};
+
+// Measurements of all algorithms for a single event
+struct EventMeasurements {
+  std::vector<Duration> clocks;
+  // empty if the resource instrumentation is disabled
+  std::vector<ActsExamples::ResourceUsage> usages;
+
+  EventMeasurements(size_t numClocks, size_t numUsages)
+      : clocks(numClocks, Duration::zero()), usages(numUsages) {}
+
+  // reset all measurements for the next event without reallocating
+  void reset() {
+    std::fill(clocks.begin(), clocks.end(), Duration::zero());
+    std::fill(usages.begin(), usages.end(), ActsExamples::ResourceUsage());
+  }
+};
+
+// RAII-based probe to measure the execution of an algorithm within a block
+struct AlgorithmProbe {
+  StopWatch sw;
+  std::optional<ActsExamples::ResourceProbe> resources;
+
+  AlgorithmProbe(EventMeasurements& measurements, size_t i)
+      : sw(measurements.clocks[i]) {
+    if (not measurements.usages.empty()) {
+      resources.emplace(measurements.usages[i]);
+    }
+  }
+};
+
+// Append the resource usage of one event to the given records.
+void appendResources(const std::vector<std::string>& identifiers,
+                     size_t event, const EventMeasurements& measurements,
+                     std::vector<ResourceInfo>& records) {
+  for (size_t i = 0; i < measurements.usages.size(); ++i) {
+    const ActsExamples::ResourceUsage& usage = measurements.usages[i];
+    ResourceInfo info;
+    info.event_id = event;
+    info.identifier = identifiers[i];
+    info.time_s =
+        std::chrono::duration_cast<Seconds>(measurements.clocks[i]).count();
+    info.cpu_time_s = usage.cpuTimeNs / 1e9;
+    info.max_rss_increase_kb = usage.maxRssIncreaseKb;
+    info.allocations = usage.allocations;
+    info.allocated_bytes = usage.allocatedBytes;
+    info.cycles = usage.cycles;
+    info.instructions = usage.instructions;
+    info.cache_misses = usage.cacheMisses;
+    records.push_back(std::move(info));
+  }
+}
+
+// Dependencies between algorithms derived from their declared inputs and
+// outputs. Algorithms are only ever ordered after algorithms added before
+// them, i.e. the graph is acyclic by construction.
+struct AlgorithmGraph {
+  // algorithms that must wait for the given algorithm
+  std::vector<std::vector<size_t>> successors;
+  // number of algorithms the given algorithm must wait for
+  std::vector<size_t> numPredecessors;
+};
+
+AlgorithmGraph buildAlgorithmGraph(
+    const std::vector<std::shared_ptr<ActsExamples::IAlgorithm>>& algorithms) {
+  const size_t n = algorithms.size();
+  std::vector<std::vector<std::string>> inputs(n);
+  std::vector<std::vector<std::string>> outputs(n);
+  for (size_t i = 0; i < n; ++i) {
+    inputs[i] = algorithms[i]->inputs();
+    outputs[i] = algorithms[i]->outputs();
+  }
+  auto undeclared = [&](size_t i) {
+    return inputs[i].empty() and outputs[i].empty();
+  };
+  auto intersect = [](const std::vector<std::string>& a,
+                      const std::vector<std::string>& b) {
+    return std::any_of(a.begin(), a.end(), [&](const std::string& name) {
+      return std::find(b.begin(), b.end(), name) != b.end();
+    });
+  };
+
+  AlgorithmGraph graph;
+  graph.successors.resize(n);
+  graph.numPredecessors.assign(n, 0u);
+  for (size_t i = 0; i < n; ++i) {
+    for (size_t j = 0; j < i; ++j) {
+      // besides true data dependencies, keep the insertion order for
+      // algorithms that do not declare anything and for all other accesses
+      // to the same object such that errors are reported as before.
+      if (undeclared(i) or undeclared(j) or intersect(outputs[j], inputs[i]) or
+          intersect(outputs[j], outputs[i]) or
+          intersect(inputs[j], outputs[i])) {
+        graph.successors[j].push_back(i);
+        graph.numPredecessors[i] += 1;
+      }
+    }
+  }
+  return graph;
+}
+
+// Execute all algorithms for a batch of events respecting their dependencies.
+//
+// The contexts are copied for every algorithm with the algorithm number it
+// would have in sequential execution. Failures are propagated as exceptions.
+void executeAlgorithmGraph(
+    const std::vector<std::shared_ptr<ActsExamples::IAlgorithm>>& algorithms,
+    const AlgorithmGraph& graph,
+    const std::vector<ActsExamples::AlgorithmContext>& contexts,
+    EventMeasurements& measurements, size_t offset) {
+  std::vector<std::atomic<size_t>> pending(algorithms.size());
+  for (size_t i = 0; i < algorithms.size(); ++i) {
+    pending[i] = graph.numPredecessors[i];
+  }
+
+  tbb::task_group tasks;
+  std::function<void(size_t)> execute = [&](size_t i) {
+    std::vector<ActsExamples::AlgorithmContext> algorithmContexts = contexts;
+    for (auto& algorithmContext : algorithmContexts) {
+      algorithmContext.algorithmNumber += i + 1;
+    }
+    {
+      AlgorithmProbe probe(measurements, offset + i);
+      if (algorithms[i]->executeBatch(algorithmContexts) !=
+          ActsExamples::ProcessCode::SUCCESS) {
+        throw std::runtime_error("Failed to process event data");
+      }
+    }
+    for (size_t successor : graph.successors[i]) {
+      if (--pending[successor] == 0u) {
+        tasks.run([&, successor] { execute(successor); });
+      }
+    }
+  };
+  for (size_t i = 0; i < algorithms.size(); ++i) {
+    if (graph.numPredecessors[i] == 0u) {
+      tasks.run([&, i] { execute(i); });
+    }
+  }
+  tasks.wait();
+}
+
 void storeTiming(const std::vector<std::string>& identifiers,
                  const std::vector<Duration>& durations, std::size_t numEvents,
                  std::string path) {
@@ -223,6 +385,18 @@ void storeTiming(const std::vector<std::string>& identifiers,
     writer.append(info);
   }
 }
+
+void storeResources(std::vector<ResourceInfo> records, std::string path) {
+  // events are recorded in completion order
+  std::stable_sort(records.begin(), records.end(),
+                   [](const ResourceInfo& lhs, const ResourceInfo& rhs) {
+                     return lhs.event_id < rhs.event_id;
+                   });
+  dfe::NamedTupleCsvWriter<ResourceInfo> writer(std::move(path), 9);
+  for (const auto& info : records) {
+    writer.append(info);
+  }
+}
 }  // namespace
 
 int ActsExamples::Sequencer::run() {
@@ -232,6 +406,9 @@ int ActsExamples::Sequencer::run() {
   std::vector<std::string> names = listAlgorithmNames();
   std::vector<Duration> clocksAlgorithms(names.size(), Duration::zero());
   tbb::queuing_mutex clocksAlgorithmsMutex;
+  // per-event resource usage is only recorded for the per-event steps
+  const size_t numUsages = m_cfg.instrumentAlgorithms ? names.size() : 0u;
+  std::vector<ResourceInfo> resourcesEvents;
 
   // processing only works w/ a well-known number of events
   // error message is already handled by the helper function
@@ -243,11 +420,38 @@ int ActsExamples::Sequencer::run() {
   ACTS_INFO("Processing events [" << eventsRange.first << ", "
                                   << eventsRange.second << ")");
   ACTS_INFO("Starting event loop with " << m_cfg.numThreads << " threads");
+  if (0u < m_cfg.eventsInFlight) {
+    ACTS_INFO("  pipelined with up to " << m_cfg.eventsInFlight
+                                        << " events in flight");
+  }
+  if (1u < m_cfg.eventBatchSize) {
+    ACTS_INFO("  in batches of " << m_cfg.eventBatchSize << " events");
+  }
   ACTS_INFO("  " << m_services.size() << " services");
   ACTS_INFO("  " << m_decorators.size() << " context decorators");
   ACTS_INFO("  " << m_readers.size() << " readers");
   ACTS_INFO("  " << m_algorithms.size() << " algorithms");
   ACTS_INFO("  " << m_writers.size() << " writers");
+  if (m_cfg.instrumentAlgorithms) {
+    ACTS_INFO("Recording per-event resource usage");
+    if (not hardwareCountersAvailable()) {
+      ACTS_INFO("  hardware counters are not available");
+    }
+    if (not allocationHookActive()) {
+      ACTS_INFO("  allocations are not counted without the allocation hook");
+    }
+  }
+
+  // algorithm dependencies are only needed for concurrent execution
+  AlgorithmGraph algorithmGraph;
+  if (m_cfg.parallelAlgorithms) {
+    algorithmGraph = buildAlgorithmGraph(m_algorithms);
+    for (size_t i = 0; i < m_algorithms.size(); ++i) {
+      ACTS_DEBUG("Algorithm '" << m_algorithms[i]->name() << "' waits for "
+                               << algorithmGraph.numPredecessors[i]
+                               << " algorithm(s)");
+    }
+  }
 
   // run start-of-run hooks
   for (auto& service : m_services) {
@@ -257,80 +461,228 @@ int ActsExamples::Sequencer::run() {
     service->startRun();
   }
 
-  // execute the parallel event loop
+  // process a batch of events up to and including the algorithms. every
+  // step handles all events of the batch before the next step is run.
+  auto processBatch = [&](std::vector<AlgorithmContext>& contexts,
+                          EventMeasurements& measurements) {
+    size_t ialgo = 0;
+
+    // Prepare event store w/ service information
+    for (auto& service : m_services) {
+      AlgorithmProbe probe(measurements, ialgo++);
+      for (auto& context : contexts) {
+        service->prepare(++context);
+      }
+    }
+    /// Decorate the context
+    for (auto& cdr : m_decorators) {
+      AlgorithmProbe probe(measurements, ialgo++);
+      for (auto& context : contexts) {
+        if (cdr->decorate(++context) != ProcessCode::SUCCESS) {
+          throw std::runtime_error("Failed to decorate event context");
+        }
+      }
+    }
+    // Read everything in
+    for (auto& rdr : m_readers) {
+      AlgorithmProbe probe(measurements, ialgo++);
+      for (auto& context : contexts) {
+        if (rdr->read(++context) != ProcessCode::SUCCESS) {
+          throw std::runtime_error("Failed to read input data");
+        }
+      }
+    }
+    // Execute all algorithms
+    if (m_cfg.parallelAlgorithms) {
+      executeAlgorithmGraph(m_algorithms, algorithmGraph, contexts,
+                            measurements, ialgo);
+      for (auto& context : contexts) {
+        context.algorithmNumber += m_algorithms.size();
+      }
+    } else {
+      for (auto& alg : m_algorithms) {
+        AlgorithmProbe probe(measurements, ialgo++);
+        for (auto& context : contexts) {
+          ++context;
+        }
+        if (alg->executeBatch(contexts) != ProcessCode::SUCCESS) {
+          throw std::runtime_error("Failed to process event data");
+        }
+      }
+    }
+  };
+  // write a single processed event
   std::atomic<size_t> nProcessedEvents = 0;
   size_t nTotalEvents = eventsRange.second - eventsRange.first;
+  auto writeEvent = [&](AlgorithmContext& context,
+                        EventMeasurements& measurements) {
+    size_t ialgo = m_services.size() + m_decorators.size() + m_readers.size() +
+                   m_algorithms.size();
+
+    // Write out results
+    for (auto& wrt : m_writers) {
+      AlgorithmProbe probe(measurements, ialgo++);
+      if (wrt->write(++context) != ProcessCode::SUCCESS) {
+        throw std::runtime_error("Failed to write output data");
+      }
+    }
+
+    nProcessedEvents++;
+    if (nTotalEvents <= 100) {
+      ACTS_INFO("finished event " << context.eventNumber);
+    } else {
+      if (nProcessedEvents % 100 == 0) {
+        ACTS_INFO(nProcessedEvents << " / " << nTotalEvents
+                                   << " events processed");
+      }
+    }
+  };
+  // event stores are reused for many events and share the same name
+  std::function<std::unique_ptr<const Acts::Logger>()> makeEventStoreLogger =
+      [&]() { return Acts::getDefaultLogger("EventStore", m_cfg.logLevel); };
+
+  // events are processed in batches of consecutive events; the last batch
+  // might be smaller
+  const size_t batchSize = std::max<size_t>(m_cfg.eventBatchSize, 1u);
+  const size_t numBatches = (nTotalEvents + batchSize - 1) / batchSize;
+  auto batchRange = [&](size_t batch) {
+    size_t begin = eventsRange.first + batch * batchSize;
+    return std::make_pair(begin,
+                          std::min(begin + batchSize, eventsRange.second));
+  };
+  // the event stores of a batch are cleared and reused for the next batch
+  struct EventBatch {
+    std::vector<std::unique_ptr<WhiteBoard>> eventStores;
+    std::vector<AlgorithmContext> contexts;
+    EventMeasurements measurements;
+
+    EventBatch(size_t size, size_t numClocks, size_t numUsages,
+               const std::function<std::unique_ptr<const Acts::Logger>()>&
+                   makeLogger)
+        : measurements(numClocks, numUsages) {
+      for (size_t i = 0; i < size; ++i) {
+        eventStores.push_back(std::make_unique<WhiteBoard>(makeLogger()));
+      }
+      contexts.reserve(size);
+    }
+    // prepare the contexts for the events [begin, end)
+    void start(size_t begin, size_t end) {
+      for (size_t event = begin; event != end; ++event) {
+        contexts.emplace_back(0, event, *eventStores[event - begin]);
+      }
+      measurements.reset();
+    }
+    void finish() {
+      contexts.clear();
+      for (auto& eventStore : eventStores) {
+        eventStore->clear();
+      }
+    }
+  };
+
   tbb::task_scheduler_init init(m_cfg.numThreads);
-  tbb::parallel_for(
-      tbb::blocked_range<size_t>(eventsRange.first, eventsRange.second),
-      [&](const tbb::blocked_range<size_t>& r) {
-        std::vector<Duration> localClocksAlgorithms(names.size(),
-                                                    Duration::zero());
-
-        for (size_t event = r.begin(); event != r.end(); ++event) {
-          // Use per-event store
-          WhiteBoard eventStore(Acts::getDefaultLogger(
-              "EventStore#" + std::to_string(event), m_cfg.logLevel));
-          // If we ever wanted to run algorithms in parallel, this needs to be
-          // changed to Algorithm context copies
-          AlgorithmContext context(0, event, eventStore);
-          size_t ialgo = 0;
-
-          // Prepare event store w/ service information
-          for (auto& service : m_services) {
-            StopWatch sw(localClocksAlgorithms[ialgo++]);
-            service->prepare(++context);
-          }
-          /// Decorate the context
-          for (auto& cdr : m_decorators) {
-            StopWatch sw(localClocksAlgorithms[ialgo++]);
-            if (cdr->decorate(++context) != ProcessCode::SUCCESS) {
-              throw std::runtime_error("Failed to decorate event context");
-            }
-          }
-          // Read everything in
-          for (auto& rdr : m_readers) {
-            StopWatch sw(localClocksAlgorithms[ialgo++]);
-            if (rdr->read(++context) != ProcessCode::SUCCESS) {
-              throw std::runtime_error("Failed to read input data");
-            }
-          }
-          // Execute all algorithms
-          for (auto& alg : m_algorithms) {
-            StopWatch sw(localClocksAlgorithms[ialgo++]);
-            if (alg->execute(++context) != ProcessCode::SUCCESS) {
-              throw std::runtime_error("Failed to process event data");
+  if (0u < m_cfg.eventsInFlight) {
+    // execute the pipelined event loop. only a bounded number of batches is
+    // kept in memory; writers are called for one event at a time and in
+    // event order.
+    const size_t batchesInFlight =
+        std::max<size_t>(m_cfg.eventsInFlight / batchSize, 1u);
+    // the in-order input and output stages guarantee that the batches in
+    // flight are consecutive, i.e. their slots never collide.
+    std::vector<std::unique_ptr<EventBatch>> slots;
+    for (size_t i = 0; i < batchesInFlight; ++i) {
+      slots.push_back(std::make_unique<EventBatch>(
+          batchSize, names.size(), numUsages, makeEventStoreLogger));
+    }
+    auto slot = [&](size_t batch) -> EventBatch& {
+      return *slots[batch % slots.size()];
+    };
+    size_t nextBatch = 0;
+
+    tbb::parallel_pipeline(
+        batchesInFlight,
+        tbb::make_filter<void, size_t>(
+            tbb::filter::serial_in_order,
+            [&](tbb::flow_control& fc) -> size_t {
+              if (nextBatch == numBatches) {
+                fc.stop();
+                return SIZE_MAX;
+              }
+              size_t batch = nextBatch++;
+              auto [begin, end] = batchRange(batch);
+              slot(batch).start(begin, end);
+              return batch;
+            }) &
+            tbb::make_filter<size_t, size_t>(
+                tbb::filter::parallel,
+                [&](size_t batch) {
+                  EventBatch& inFlight = slot(batch);
+                  processBatch(inFlight.contexts, inFlight.measurements);
+                  return batch;
+                }) &
+            tbb::make_filter<size_t, void>(
+                tbb::filter::serial_in_order, [&](size_t batch) {
+                  EventBatch& inFlight = slot(batch);
+                  for (auto& context : inFlight.contexts) {
+                    writeEvent(context, inFlight.measurements);
+                  }
+                  // the output stage is serial, no locking required
+                  for (size_t i = 0; i < clocksAlgorithms.size(); ++i) {
+                    clocksAlgorithms[i] += inFlight.measurements.clocks[i];
+                  }
+                  appendResources(names, batchRange(batch).first,
+                                  inFlight.measurements, resourcesEvents);
+                  inFlight.finish();
+                }));
+  } else {
+    // execute the parallel event loop
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0u, numBatches),
+        [&](const tbb::blocked_range<size_t>& r) {
+          std::vector<Duration> localClocksAlgorithms(names.size(),
+                                                      Duration::zero());
+          std::vector<ResourceInfo> localResources;
+
+          // the event stores and measurements are reused for every batch
+          EventBatch local(batchSize, names.size(), numUsages,
+                           makeEventStoreLogger);
+          for (size_t batch = r.begin(); batch != r.end(); ++batch) {
+            auto [begin, end] = batchRange(batch);
+            local.start(begin, end);
+            processBatch(local.contexts, local.measurements);
+            for (auto& context : local.contexts) {
+              writeEvent(context, local.measurements);
             }
-          }
-          // Write out results
-          for (auto& wrt : m_writers) {
-            StopWatch sw(localClocksAlgorithms[ialgo++]);
-            if (wrt->write(++context) != ProcessCode::SUCCESS) {
-              throw std::runtime_error("Failed to write output data");
+            for (size_t i = 0; i < localClocksAlgorithms.size(); ++i) {
+              localClocksAlgorithms[i] += local.measurements.clocks[i];
             }
+            appendResources(names, begin, local.measurements,
+                            localResources);
+            local.finish();
           }
 
-          nProcessedEvents++;
-          if (nTotalEvents <= 100) {
-            ACTS_INFO("finished event " << event);
-          } else {
-            if (nProcessedEvents % 100 == 0) {
-              ACTS_INFO(nProcessedEvents << " / " << nTotalEvents
-                                         << " events processed");
+          // add timing info to global information
+          {
+            tbb::queuing_mutex::scoped_lock lock(clocksAlgorithmsMutex);
+            for (size_t i = 0; i < clocksAlgorithms.size(); ++i) {
+              clocksAlgorithms[i] += localClocksAlgorithms[i];
             }
+            resourcesEvents.insert(resourcesEvents.end(),
+                                   localResources.begin(),
+                                   localResources.end());
           }
-        }
-
-        // add timing info to global information
-        {
-          tbb::queuing_mutex::scoped_lock lock(clocksAlgorithmsMutex);
-          for (size_t i = 0; i < clocksAlgorithms.size(); ++i) {
-            clocksAlgorithms[i] += localClocksAlgorithms[i];
-          }
-        }
-      });
+        });
+  }
 
   // run end-of-run hooks
+  for (auto& alg : m_algorithms) {
+    names.push_back("Algorithm:" + alg->name() + ":finalize");
+    clocksAlgorithms.push_back(Duration::zero());
+    StopWatch sw(clocksAlgorithms.back());
+    if (alg->finalize() != ProcessCode::SUCCESS) {
+      return EXIT_FAILURE;
+    }
+  }
   for (auto& wrt : m_writers) {
     names.push_back("Writer:" + wrt->name() + ":endRun");
     clocksAlgorithms.push_back(Duration::zero());
@@ -355,6 +707,10 @@ int ActsExamples::Sequencer::run() {
   }
   storeTiming(names, clocksAlgorithms, numEvents,
               joinPaths(m_cfg.outputDir, "timing.tsv"));
+  if (m_cfg.instrumentAlgorithms) {
+    storeResources(std::move(resourcesEvents),
+                   joinPaths(m_cfg.outputDir, "resources.csv"));
+  }
 
   return EXIT_SUCCESS;
 }
@@ -0,0 +1,38 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+size_t ActsExamples::detail::resolveWhiteBoardSlot(const std::string& name) {
+  static std::shared_mutex mutex;
+  static std::unordered_map<std::string, size_t> slots;
+
+  // names are registered once during setup and only looked up afterwards,
+  // so concurrent lookups must not serialize on each other
+  {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    auto it = slots.find(name);
+    if (it != slots.end()) {
+      return it->second;
+    }
+  }
+  std::unique_lock<std::shared_mutex> lock(mutex);
+  // a new name receives the next free slot
+  return slots.emplace(name, slots.size()).first->second;
+}
+
+void ActsExamples::WhiteBoard::clear() {
+  // keep the slots such that the next event does not need to reallocate
+  for (auto& holder : m_store) {
+    holder.reset();
+  }
+}
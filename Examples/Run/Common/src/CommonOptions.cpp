@@ -42,7 +42,18 @@ void ActsExamples::Options::addSequencerOptions(
       "skip", value<size_t>()->default_value(0),
       "The number of events to skip")(
       "jobs,j", value<int>()->default_value(-1),
-      "Number of parallel jobs, negative for automatic.");
+      "Number of parallel jobs, negative for automatic.")(
+      "parallel-algorithms", bool_switch(),
+      "Execute independent algorithms of the same event concurrently.")(
+      "events-in-flight", value<size_t>()->default_value(0),
+      "Maximum number of events processed concurrently in a pipeline that "
+      "writes the events in order. Zero disables the pipeline.")(
+      "instrument-algorithms", bool_switch(),
+      "Record per-event cpu time, memory, allocations, and hardware counters "
+      "of every algorithm in resources.csv. Allocations are only counted "
+      "with the ActsExamplesFrameworkAllocationHook library preloaded.")(
+      "event-batch-size", value<size_t>()->default_value(1),
+      "Number of consecutive events that algorithms process together.");
 }
 
 void ActsExamples::Options::addRandomNumbersOptions(
@@ -174,6 +185,10 @@ ActsExamples::Sequencer::Config ActsExamples::Options::readSequencerConfig(
   }
   cfg.logLevel = readLogLevel(vm);
   cfg.numThreads = vm["jobs"].as<int>();
+  cfg.parallelAlgorithms = vm["parallel-algorithms"].as<bool>();
+  cfg.eventsInFlight = vm["events-in-flight"].as<size_t>();
+  cfg.instrumentAlgorithms = vm["instrument-algorithms"].as<bool>();
+  cfg.eventBatchSize = vm["event-batch-size"].as<size_t>();
   if (not vm["output-dir"].empty()) {
     cfg.outputDir = vm["output-dir"].as<std::string>();
   }
@@ -15,10 +15,14 @@
 #include "Acts/Utilities/PdgParticle.hpp"
 #include "ActsFatras/Utilities/ParticleData.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <cstdlib>
 #include <iomanip>
 #include <iostream>
+#include <optional>
+#include <stdexcept>
 
 using namespace Acts::UnitLiterals;
 
@@ -38,6 +42,10 @@ static void printHeader(std::ostream& os, const Acts::MaterialSlab& slab,
   os << "# delta_ion is the energy loss due to ionisation and excitation\n";
   os << "# delta_rad is the energy loss due to radiative effects\n";
   os << "# sigma is the width of the enery loss distribution\n";
+  os << "# dev_ion is the relative deviation of the tabulated ionisation\n";
+  os << "#   loss from the exact value\n";
+  os << "# dev_mpv is the deviation of the tabulated most probable\n";
+  os << "#   ionisation loss from the exact value relative to sigma\n";
   // column names
   os << std::left;
   os << std::setw(width) << "momentum" << separator;
@@ -46,11 +54,14 @@ static void printHeader(std::ostream& os, const Acts::MaterialSlab& slab,
   os << std::setw(width) << "delta" << separator;
   os << std::setw(width) << "delta_ion" << separator;
   os << std::setw(width) << "delta_rad" << separator;
-  os << std::setw(width) << "sigma" << '\n';
+  os << std::setw(width) << "sigma" << separator;
+  os << std::setw(width) << "dev_ion" << separator;
+  os << std::setw(width) << "dev_mpv" << '\n';
 }
 
 static void printLine(std::ostream& os, float mass, float momentum, float delta,
-                      float deltaIon, float deltaRad, float sigma) {
+                      float deltaIon, float deltaRad, float sigma,
+                      float devIon, float devMpv) {
   const auto energy = std::sqrt(mass * mass + momentum * momentum);
   const auto beta = momentum / energy;
   const auto betaGamma = momentum / mass;
@@ -61,7 +72,10 @@ static void printLine(std::ostream& os, float mass, float momentum, float delta,
   os << std::setw(width) << delta / 1_MeV << separator;
   os << std::setw(width) << deltaIon / 1_MeV << separator;
   os << std::setw(width) << deltaRad / 1_MeV << separator;
-  os << std::setw(width) << sigma / 1_MeV << '\n';
+  os << std::setw(width) << sigma / 1_MeV << separator;
+  os << std::scientific;
+  os << std::setw(width) << devIon << separator;
+  os << std::setw(width) << devMpv << '\n';
 }
 
 int main(int argc, char const* argv[]) {
@@ -92,7 +106,25 @@ int main(int argc, char const* argv[]) {
       35.28_cm, 42.10_cm, 9.012, 4, 1.848_g / 1_cm3);
   const Acts::MaterialSlab slab(material, thickness);
 
+  // tabulate the interactions over the scanned momentum range
+  std::optional<Acts::InteractionsTable> table;
+  try {
+    Acts::InteractionsTable::Config cfg;
+    cfg.pMin = pmin;
+    cfg.pMax = pmax;
+    table.emplace(cfg, material, pdg, mass, charge);
+  } catch (const std::invalid_argument& e) {
+    std::cerr << "no tabulated interactions: " << e.what() << '\n';
+  }
+
   printHeader(std::cout, slab, pdg, mass, charge);
+  if (table) {
+    std::cout << "# tabulated with " << table->size()
+              << " points, maximum deviation at the midpoints "
+              << table->maxRelativeError() << '\n';
+  }
+  float maxDevIon = 0.0f;
+  float maxDevMpv = 0.0f;
   // scan momentum
   for (auto p = pmin; p < pmax; p += deltap) {
     const auto qOverP = charge / p;
@@ -106,7 +138,25 @@ int main(int argc, char const* argv[]) {
     const auto sigma =
         Acts::computeEnergyLossLandauSigma(slab, pdg, mass, qOverP, charge);
 
-    printLine(std::cout, mass, p, delta, deltaIon, deltaRad, sigma);
+    float devIon = 0.0f;
+    float devMpv = 0.0f;
+    if (table) {
+      const auto mpv =
+          Acts::computeEnergyLossLandau(slab, pdg, mass, qOverP, charge);
+      devIon = std::abs(table->computeEnergyLossBethe(slab, qOverP) / deltaIon -
+                        1.0f);
+      devMpv =
+          std::abs(table->computeEnergyLossLandau(slab, qOverP) - mpv) / sigma;
+      maxDevIon = std::max(maxDevIon, devIon);
+      maxDevMpv = std::max(maxDevMpv, devMpv);
+    }
+
+    printLine(std::cout, mass, p, delta, deltaIon, deltaRad, sigma, devIon,
+              devMpv);
+  }
+  if (table) {
+    std::cout << "# maximum deviation ionisation " << maxDevIon
+              << " most probable " << maxDevMpv << '\n';
   }
 
   return EXIT_SUCCESS;
@@ -0,0 +1,116 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Utilities/BinUtility.hpp"
+#include "Acts/Utilities/BinnedArrayFlat.hpp"
+#include "Acts/Utilities/BinnedArrayXD.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+namespace po = boost::program_options;
+using namespace Acts;
+
+int main(int argc, char* argv[]) {
+  unsigned int lvl = Acts::Logging::INFO;
+  unsigned int toys = 1;
+
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+  desc.add_options()
+      ("help", "produce help message")
+      ("toys", po::value<unsigned int>(&toys)->default_value(10000),
+       "number of runs over the lookup positions")
+      ("verbose",
+       po::value<unsigned int>(&lvl)->default_value(Acts::Logging::INFO),
+       "logging level");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help") != 0u) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  ACTS_LOCAL_LOGGER(getDefaultLogger("BinnedArray", Acts::Logging::Level(lvl)));
+
+  // the objects are only used for their address
+  std::vector<int> objects(1000);
+  using Object = const int*;
+  using ObjectsAndPositions = std::vector<std::pair<Object, Vector3>>;
+
+  std::minstd_rand rng;
+  std::uniform_real_distribution<double> dist(0., 6.);
+  std::vector<Vector3> positions;
+  for (size_t i = 0; i < 1000; ++i) {
+    positions.emplace_back(dist(rng), dist(rng), dist(rng));
+  }
+
+  // one object per bin, at the bin center
+  auto fill = [&](const BinUtility& bu) {
+    ObjectsAndPositions tapVector;
+    for (size_t i0 = 0; i0 < bu.bins(0); ++i0) {
+      for (size_t i1 = 0; i1 < bu.bins(1); ++i1) {
+        const double step0 = 6. / bu.bins(0);
+        const double step1 = 6. / bu.bins(1);
+        tapVector.emplace_back(
+            &objects.at(i0 + bu.bins(0) * i1),
+            Vector3((i0 + 0.5) * step0, (i1 + 0.5) * step1, 0.));
+      }
+    }
+    return tapVector;
+  };
+
+  auto benchmark = [&](const std::string& name,
+                       const BinnedArray<Object>& array) {
+    size_t found = 0;
+    const auto result = Acts::Test::microBenchmark(
+        [&](const Vector3& position) {
+          found += array.object(position) != nullptr ? 1 : 0;
+        },
+        positions, toys);
+    ACTS_INFO("Execution stats " << name << ": " << result);
+    ACTS_INFO("Found objects: " << found);
+  };
+
+  // 1D, e.g. a layer array with arbitrary boundaries
+  std::vector<float> boundaries;
+  for (unsigned int ib = 0; ib < 21; ++ib) {
+    boundaries.push_back(ib * 6. / 20.);
+  }
+  const BinUtility bu1(boundaries, open, binX);
+  BinnedArrayXD<Object> nested1(fill(bu1), std::make_unique<BinUtility>(bu1));
+  BinnedArrayFlat<Object, 1> flat1(fill(bu1),
+                                   std::make_unique<BinUtility>(bu1));
+  benchmark("nested 1D", nested1);
+  benchmark("flat 1D", flat1);
+
+  // 2D with equidistant binning
+  BinUtility bu2(20, 0., 6., open, binX);
+  bu2 += BinUtility(20, 0., 6., open, binY);
+  BinnedArrayXD<Object> nested2(fill(bu2), std::make_unique<BinUtility>(bu2));
+  BinnedArrayFlat<Object, 2> flat2(fill(bu2),
+                                   std::make_unique<BinUtility>(bu2));
+  benchmark("nested 2D", nested2);
+  benchmark("flat 2D", flat2);
+
+  return 0;
+}
@@ -0,0 +1,111 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/MagneticField/BFieldMapUtils.hpp"
+#include "Acts/MagneticField/CompactBFieldMap.hpp"
+#include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Acts::UnitLiterals;
+
+int main(int argc, char* argv[]) {
+  size_t runs = 1000;
+  size_t nBinsXY = 100;
+  size_t nBinsZ = 150;
+  if (argc >= 2) {
+    runs = std::stoi(argv[1]);
+  }
+  if (argc >= 3) {
+    nBinsXY = std::stoi(argv[2]);
+  }
+  if (argc >= 4) {
+    nBinsZ = std::stoi(argv[3]);
+  }
+
+  const double L = 5.8_m;
+  const double R = (2.56 + 2.46) * 0.5 * 0.5_m;
+  // a smooth solenoid-like field, sampling the analytical SolenoidBField on
+  // a large grid takes minutes
+  auto field = [&](double x, double y, double z) {
+    const double fz = 1. / (1. + std::pow(z / (0.5 * L), 8));
+    const double fr = 1. / (1. + (x * x + y * y) / (R * R));
+    const double br = 0.1 * 2_T * z / (R * L);
+    return Acts::Vector3(br * x, br * y, 2_T * fz * fr);
+  };
+
+  // sample the field on a cartesian grid, field values in native units
+  std::cout << "Building cartesian field map with " << nBinsXY << "x"
+            << nBinsXY << "x" << nBinsZ << " points" << std::endl;
+  const double xyMax = 1.5 * R;
+  const double zMax = L;
+  std::vector<double> xyPos, zPos;
+  for (size_t i = 0; i < nBinsXY; ++i) {
+    xyPos.push_back(-xyMax + 2. * xyMax * i / (nBinsXY - 1));
+  }
+  for (size_t i = 0; i < nBinsZ; ++i) {
+    zPos.push_back(-zMax + 2. * zMax * i / (nBinsZ - 1));
+  }
+  std::vector<Acts::Vector3> values;
+  values.reserve(nBinsXY * nBinsXY * nBinsZ);
+  for (double x : xyPos) {
+    for (double y : xyPos) {
+      for (double z : zPos) {
+        values.push_back(field(x, y, z));
+      }
+    }
+  }
+  auto localToGlobalBin = [](std::array<size_t, 3> bins,
+                             std::array<size_t, 3> nBins) {
+    return bins[0] * nBins[1] * nBins[2] + bins[1] * nBins[2] + bins[2];
+  };
+  auto mapper = Acts::fieldMapperXYZ(localToGlobalBin, xyPos, xyPos, zPos,
+                                     std::move(values), 1., 1.);
+
+  Acts::CompactBFieldMap<> compactMap(mapper.getGrid());
+  using BField_t = Acts::InterpolatedBFieldMap<decltype(mapper)>;
+  BField_t bFieldMap(BField_t::Config(std::move(mapper)));
+  Acts::MagneticFieldContext mctx{};
+
+  // Random positions measure the lookup including cache misses on the field
+  // map, advancing positions measure the cached lookup along a straight line
+  // as in propagation.
+  std::minstd_rand rng;
+  std::uniform_real_distribution<> xyDist(-xyMax, xyMax);
+  std::uniform_real_distribution<> zDist(-zMax, zMax);
+  std::vector<Acts::Vector3> randomPositions, advancingPositions;
+  const Acts::Vector3 dir = Acts::Vector3(0.3, 0.2, 0.9).normalized();
+  for (size_t i = 0; i < 4096; ++i) {
+    randomPositions.emplace_back(xyDist(rng), xyDist(rng), zDist(rng));
+    advancingPositions.push_back(dir * (1_mm * i));
+  }
+
+  auto benchmark = [&](const std::string& name, const auto& bField) {
+    using Cache = typename std::decay_t<decltype(bField)>::Cache;
+    Cache cache{mctx};
+    auto lookup = [&](const Acts::Vector3& pos) {
+      return bField.getField(pos, cache);
+    };
+    std::cout << "Benchmarking random " << name << " lookup: " << std::flush;
+    std::cout << Acts::Test::microBenchmark(lookup, randomPositions, runs)
+              << std::endl;
+    std::cout << "Benchmarking advancing " << name
+              << " lookup: " << std::flush;
+    std::cout << Acts::Test::microBenchmark(lookup, advancingPositions, runs)
+              << std::endl;
+  };
+
+  benchmark("interpolated field map", bFieldMap);
+  benchmark("compact field map", compactMap);
+}
@@ -12,11 +12,15 @@
 #include "Acts/MagneticField/ConstantBField.hpp"
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
 #include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/MultiTrackEigenStepper.hpp"
+#include "Acts/Propagator/MultiTrackPropagator.hpp"
 #include "Acts/Propagator/Propagator.hpp"
 #include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
 #include "Acts/Utilities/Logger.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <vector>
 
 #include <boost/program_options.hpp>
 
@@ -31,6 +35,7 @@ int main(int argc, char* argv[]) {
   double maxPathInM = 1;
   unsigned int lvl = Acts::Logging::INFO;
   bool withCov = true;
+  bool batched = false;
 
   // Create a test context
   GeometryContext tgContext = GeometryContext();
@@ -46,6 +51,9 @@ int main(int argc, char* argv[]) {
       ("B",po::value<double>(&BzInT)->default_value(2),"z-component of B-field in T")
       ("path",po::value<double>(&maxPathInM)->default_value(5),"maximum path length in m")
       ("cov",po::value<bool>(&withCov)->default_value(true),"propagation with covariance matrix")
+      ("batched",po::value<bool>(&batched)->default_value(false),
+       "propagate groups of tracks with the multi-track stepper, "
+       "without covariance")
       ("verbose",po::value<unsigned int>(&lvl)->default_value(Acts::Logging::INFO),"logging level");
     // clang-format on
     po::variables_map vm;
@@ -100,6 +108,41 @@ int main(int argc, char* argv[]) {
 
   double totalPathLength = 0;
   size_t num_iters = 0;
+
+  if (batched) {
+    using MultiStepper_type = MultiTrackEigenStepper<BField_type, 4>;
+    using MultiPropagator_type = MultiTrackPropagator<MultiStepper_type>;
+    constexpr int lanes = MultiStepper_type::lanes;
+
+    MultiPropagator_type multiPropagator(
+        MultiStepper_type(BField_type(0, 0, BzInT * UnitConstants::T)));
+    MultiPropagator_type::Options multiOptions;
+    multiOptions.pathLimit = options.pathLimit;
+
+    ACTS_INFO("propagating groups of " << lanes << " tracks per call");
+    if (withCov) {
+      ACTS_INFO("the multi-track stepper does not transport the covariance");
+    }
+
+    std::vector<CurvilinearTrackParameters> group(lanes, pars);
+    const auto batch_bench_result = Acts::Test::microBenchmark(
+        [&] {
+          auto r = multiPropagator.propagate(tgContext, mfContext, group,
+                                             multiOptions);
+          for (auto& track : r) {
+            totalPathLength += track.value().pathLength;
+            ++num_iters;
+          }
+          return r;
+        },
+        1, std::max(toys / lanes, 1u));
+
+    ACTS_INFO("Execution stats per group: " << batch_bench_result);
+    ACTS_INFO("average path length = " << totalPathLength / num_iters / 1_mm
+                                       << "mm");
+    return 0;
+  }
+
   const auto propagation_bench_result = Acts::Test::microBenchmark(
       [&] {
         auto r = propagator.propagate(pars, options).value();
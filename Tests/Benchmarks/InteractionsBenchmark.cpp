@@ -0,0 +1,75 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Material/Interactions.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Tests/CommonHelpers/PredefinedMaterials.hpp"
+#include "Acts/Utilities/PdgParticle.hpp"
+
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Acts::UnitLiterals;
+
+int main(int argc, char* argv[]) {
+  size_t runs = 1000;
+  if (argc >= 2) {
+    runs = std::stoi(argv[1]);
+  }
+
+  const auto material = Acts::Test::makeSilicon();
+  const auto slab = Acts::MaterialSlab(material, 300_um);
+  const int pdg = Acts::eMuon;
+  const float mass = 105.7_MeV;
+  const float charge = -1_e;
+
+  Acts::InteractionsTable table({}, material, pdg, mass, charge);
+  std::cout << "Tabulated with " << table.size()
+            << " points, maximum relative deviation "
+            << table.maxRelativeError() << std::endl;
+
+  // momenta distributed uniformly in log-momentum
+  std::minstd_rand rng;
+  std::uniform_real_distribution<float> logP(std::log(500_MeV),
+                                             std::log(100_GeV));
+  std::vector<float> qOverPs;
+  for (size_t i = 0; i < 4096; ++i) {
+    qOverPs.push_back(charge / std::exp(logP(rng)));
+  }
+
+  auto benchmark = [&](const std::string& name, const auto& exact,
+                       const auto& tabulated) {
+    std::cout << "Benchmarking exact " << name << ": " << std::flush;
+    std::cout << Acts::Test::microBenchmark(exact, qOverPs, runs)
+              << std::endl;
+    std::cout << "Benchmarking tabulated " << name << ": " << std::flush;
+    std::cout << Acts::Test::microBenchmark(tabulated, qOverPs, runs)
+              << std::endl;
+  };
+
+  benchmark(
+      "Bethe energy loss",
+      [&](float qOverP) {
+        return Acts::computeEnergyLossBethe(slab, pdg, mass, qOverP, charge);
+      },
+      [&](float qOverP) {
+        return table.computeEnergyLossBethe(slab, qOverP);
+      });
+  benchmark(
+      "Landau energy loss",
+      [&](float qOverP) {
+        return Acts::computeEnergyLossLandau(slab, pdg, mass, qOverP, charge);
+      },
+      [&](float qOverP) {
+        return table.computeEnergyLossLandau(slab, qOverP);
+      });
+}
@@ -0,0 +1,229 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/MultiTrajectory.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Tests/CommonHelpers/TestSourceLink.hpp"
+#include "Acts/TrackFitting/GainMatrixUpdater.hpp"
+#include "Acts/TrackFitting/detail/SymmetricSystemBatch.hpp"
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Acts;
+
+namespace {
+
+using Projector = ActsMatrix<2, eBoundSize>;
+
+struct Candidate {
+  Vector2 residual;
+  SymMatrix2 covariance;
+};
+
+/// Random symmetric positive-definite covariance of the track parameters.
+///
+/// The smallest eigenvalue is scaled down by `conditioning` to create
+/// near-singular matrices.
+BoundSymMatrix makeCovariance(std::mt19937& rng, double conditioning) {
+  std::normal_distribution<double> normal(0., 1.);
+  BoundMatrix a;
+  for (int i = 0; i < a.size(); ++i) {
+    a(i) = normal(rng);
+  }
+  // random orthogonal basis
+  Eigen::HouseholderQR<BoundMatrix> qr(a);
+  const BoundMatrix q = qr.householderQ();
+  BoundVector eigenvalues;
+  eigenvalues << 1., 0.5, 0.1, 0.05, 0.01, 0.01 * conditioning;
+  return q * eigenvalues.asDiagonal() * q.transpose();
+}
+
+}  // namespace
+
+int main(int /*argc*/, char** /*argv[]*/) {
+  std::mt19937 rng(42);
+  std::normal_distribution<double> normal(0., 1.);
+
+  const GeometryContext gctx;
+  const Test::TestSourceLinkCalibrator calibrator;
+
+  Projector H = Projector::Zero();
+  H(0, eBoundLoc0) = 1;
+  H(1, eBoundLoc1) = 1;
+  const BoundSymMatrix predictedCovariance = makeCovariance(rng, 1.);
+
+  auto print_bench_result = [](const std::string& bench_name,
+                               const Acts::Test::MicroBenchmarkResult& res) {
+    std::cout << "- " << bench_name << ": " << res << std::endl;
+  };
+
+  // === Chi2 of all measurement candidates on a surface ===
+
+  std::cout << "Chi2 of 2d measurement candidates:" << std::endl;
+  for (size_t nCandidates : {1u, 4u, 16u, 64u}) {
+    std::vector<Candidate> candidates(nCandidates);
+    for (auto& candidate : candidates) {
+      candidate.residual = Vector2(normal(rng), normal(rng)) * 0.1;
+      candidate.covariance = Vector2(0.01, 0.04).asDiagonal();
+    }
+    const SymMatrix2 projectedCovariance =
+        H * predictedCovariance * H.transpose();
+
+    print_bench_result(
+        std::to_string(nCandidates) + " candidates, explicit inverse",
+        Acts::Test::microBenchmark(
+            [&] {
+              double sum = 0;
+              for (const auto& candidate : candidates) {
+                sum += (candidate.residual.transpose() *
+                        (candidate.covariance + projectedCovariance).inverse() *
+                        candidate.residual)
+                           .value();
+              }
+              return sum;
+            },
+            1000, 200));
+    print_bench_result(
+        std::to_string(nCandidates) + " candidates, batched LDLT",
+        Acts::Test::microBenchmark(
+            [&] {
+              double sum = 0;
+              detail::SymmetricSystemBatch<2> batch;
+              auto evaluate = [&] {
+                batch.factorize();
+                for (size_t lane = 0; lane < batch.size(); ++lane) {
+                  sum += batch.chi2(lane);
+                }
+                batch.clear();
+              };
+              for (size_t i = 0; i < candidates.size(); ++i) {
+                batch.push_back(
+                    i, candidates[i].residual,
+                    candidates[i].covariance + projectedCovariance);
+                if (batch.full()) {
+                  evaluate();
+                }
+              }
+              if (not batch.empty()) {
+                evaluate();
+              }
+              return sum;
+            },
+            1000, 200));
+  }
+
+  // === Full Kalman update ===
+
+  std::cout << "Kalman update with 2d measurements:" << std::endl;
+  constexpr size_t nStates = 64;
+  MultiTrajectory<Test::TestSourceLink> traj;
+  std::vector<MultiTrajectory<Test::TestSourceLink>::TrackStateProxy> states;
+  for (size_t i = 0; i < nStates; ++i) {
+    auto ts = traj.getTrackState(traj.addTrackState(TrackStatePropMask::All));
+    BoundVector predicted;
+    for (size_t j = 0; j < eBoundSize; ++j) {
+      predicted[j] = normal(rng);
+    }
+    ts.predicted() = predicted;
+    ts.predictedCovariance() = makeCovariance(rng, 1.);
+    ts.pathLength() = 0.;
+    ts.uncalibrated() = Test::TestSourceLink(
+        eBoundLoc0, eBoundLoc1, Vector2(normal(rng), normal(rng)),
+        Vector2(0.01, 0.04).asDiagonal());
+    std::visit([&](const auto& m) { ts.setCalibrated(m); },
+               calibrator(ts.uncalibrated(), nullptr));
+    states.push_back(ts);
+  }
+
+  // the update with explicit inverses, kept for reference
+  auto updateWithInverse = [&](const auto& ts) {
+    const BoundSymMatrix P = ts.predictedCovariance();
+    const SymMatrix2 V =
+        ts.calibratedCovariance().template topLeftCorner<2, 2>();
+    const ActsMatrix<eBoundSize, 2> K =
+        P * H.transpose() * (H * P * H.transpose() + V).inverse();
+    ts.filtered() = ts.predicted() + K * (ts.calibrated().template head<2>() -
+                                          H * ts.predicted());
+    ts.filteredCovariance() = (BoundMatrix::Identity() - K * H) * P;
+    return K;
+  };
+  print_bench_result(
+      "explicit inverse, per state",
+      Acts::Test::microBenchmark(updateWithInverse, states, 200));
+  print_bench_result("GainMatrixUpdater, per state",
+                     Acts::Test::microBenchmark(
+                         [&](auto ts) {
+                           return GainMatrixUpdater()(gctx, ts).ok();
+                         },
+                         states, 200));
+  print_bench_result(
+      "GainMatrixUpdater, " + std::to_string(nStates) + " states batched",
+      Acts::Test::microBenchmark(
+          [&] { return GainMatrixUpdater()(gctx, states).ok(); }, 10, 200));
+  print_bench_result(
+      "JosephFormGainMatrixUpdater, " + std::to_string(nStates) +
+          " states batched",
+      Acts::Test::microBenchmark(
+          [&] { return JosephFormGainMatrixUpdater()(gctx, states).ok(); },
+          10, 200));
+
+  // === Smoother gain and robustness against near-singular covariances ===
+
+  std::cout << "Smoother gain matrix:" << std::endl;
+  const BoundMatrix jacobian = BoundMatrix::Identity();
+  const BoundSymMatrix filteredCovariance = makeCovariance(rng, 1.);
+  print_bench_result(
+      "explicit inverse", Acts::Test::microBenchmark(
+                              [&] {
+                                return (filteredCovariance *
+                                        jacobian.transpose() *
+                                        predictedCovariance.inverse())
+                                    .eval();
+                              },
+                              1000, 200));
+  print_bench_result(
+      "LDLT solve",
+      Acts::Test::microBenchmark(
+          [&] {
+            return predictedCovariance.ldlt()
+                .solve(jacobian * filteredCovariance)
+                .transpose()
+                .eval();
+          },
+          1000, 200));
+
+  std::cout << "Failed gain matrices for near-singular covariances:"
+            << std::endl;
+  for (double conditioning : {1e-6, 1e-12, 1e-18, 0.}) {
+    constexpr size_t nTrials = 1000;
+    size_t nFailedInverse = 0;
+    size_t nFailedLdlt = 0;
+    for (size_t i = 0; i < nTrials; ++i) {
+      const BoundSymMatrix P = makeCovariance(rng, conditioning);
+      const BoundMatrix G0 =
+          filteredCovariance * jacobian.transpose() * P.inverse();
+      const auto decomposition = P.ldlt();
+      const BoundMatrix G1 =
+          decomposition.solve(jacobian * filteredCovariance).transpose();
+      nFailedInverse += G0.allFinite() ? 0 : 1;
+      nFailedLdlt +=
+          (decomposition.info() == Eigen::Success and G1.allFinite()) ? 0 : 1;
+    }
+    std::cout << "- smallest eigenvalue " << 0.01 * conditioning
+              << ": explicit inverse " << nFailedInverse << "/" << nTrials
+              << ", LDLT " << nFailedLdlt << "/" << nTrials << std::endl;
+  }
+
+  return 0;
+}
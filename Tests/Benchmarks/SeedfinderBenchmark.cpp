@@ -0,0 +1,189 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Seeding/BinFinder.hpp"
+#include "Acts/Seeding/BinnedSPGroup.hpp"
+#include "Acts/Seeding/Seed.hpp"
+#include "Acts/Seeding/SeedFilter.hpp"
+#include "Acts/Seeding/Seedfinder.hpp"
+#include "Acts/Seeding/SpacePointGrid.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+namespace po = boost::program_options;
+using namespace Acts;
+
+namespace {
+
+struct SpacePoint {
+  float m_x;
+  float m_y;
+  float m_z;
+  float x() const { return m_x; }
+  float y() const { return m_y; }
+  float z() const { return m_z; }
+};
+
+/// Space points from helical tracks through barrel layers with some noise.
+std::vector<SpacePoint> generateSpacePoints(size_t nTracks, size_t nNoise,
+                                            float bFieldInZ) {
+  std::mt19937 rng(1234);
+  std::uniform_real_distribution<float> uniformPhi(-M_PI, M_PI);
+  std::uniform_real_distribution<float> uniformEta(-2.5, 2.5);
+  std::uniform_real_distribution<float> uniformZ0(-150., 150.);
+  std::uniform_real_distribution<float> uniformPt(500., 10000.);
+  std::uniform_real_distribution<float> uniformR(30., 195.);
+  std::uniform_real_distribution<float> uniformZ(-1000., 1000.);
+  const std::vector<float> layers = {32., 72., 116., 172.};
+
+  std::vector<SpacePoint> spacePoints;
+  spacePoints.reserve(nTracks * layers.size() + nNoise);
+  for (size_t itrack = 0; itrack < nTracks; ++itrack) {
+    float phi0 = uniformPhi(rng);
+    float cotTheta = std::sinh(uniformEta(rng));
+    float z0 = uniformZ0(rng);
+    float charge = (itrack % 2) ? 1. : -1.;
+    float helixRadius = uniformPt(rng) / (300. * bFieldInZ);
+    for (float r : layers) {
+      float phi = phi0 + charge * std::asin(r / (2 * helixRadius));
+      float z = z0 + r * cotTheta;
+      if (std::abs(z) < 1000.) {
+        spacePoints.push_back(
+            SpacePoint{r * std::cos(phi), r * std::sin(phi), z});
+      }
+    }
+  }
+  for (size_t inoise = 0; inoise < nNoise; ++inoise) {
+    float r = uniformR(rng);
+    float phi = uniformPhi(rng);
+    spacePoints.push_back(
+        SpacePoint{r * std::cos(phi), r * std::sin(phi), uniformZ(rng)});
+  }
+  return spacePoints;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  unsigned int nTracks = 1;
+  unsigned int nNoise = 1;
+  unsigned int runs = 1;
+  unsigned int lvl = Acts::Logging::INFO;
+
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+  desc.add_options()
+      ("help", "produce help message")
+      ("tracks", po::value<unsigned int>(&nTracks)->default_value(10000),
+       "number of generated tracks")
+      ("noise", po::value<unsigned int>(&nNoise)->default_value(10000),
+       "number of noise space points")
+      ("runs", po::value<unsigned int>(&runs)->default_value(10),
+       "number of benchmark runs")
+      ("verbose",
+       po::value<unsigned int>(&lvl)->default_value(Acts::Logging::INFO),
+       "logging level");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help") != 0u) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  ACTS_LOCAL_LOGGER(getDefaultLogger("Seedfinder", Acts::Logging::Level(lvl)));
+
+  SeedfinderConfig<SpacePoint> config;
+  config.rMax = 200.;
+  config.deltaRMin = 1.;
+  config.deltaRMax = 60.;
+  config.collisionRegionMin = -250.;
+  config.collisionRegionMax = 250.;
+  config.zMin = -1000.;
+  config.zMax = 1000.;
+  config.maxSeedsPerSpM = 1;
+  config.cotThetaMax = 7.40627;
+  config.sigmaScattering = 50.;
+  config.radLengthPerSeed = 0.1;
+  config.minPt = 500.;
+  config.bFieldInZ = 0.00199724;
+  config.impactMax = 3.;
+  config.seedFilter = std::make_shared<SeedFilter<SpacePoint>>(
+      SeedFilter<SpacePoint>(SeedFilterConfig()));
+
+  SpacePointGridConfig gridConf;
+  gridConf.bFieldInZ = config.bFieldInZ;
+  gridConf.minPt = config.minPt;
+  gridConf.rMax = config.rMax;
+  gridConf.zMax = config.zMax;
+  gridConf.zMin = config.zMin;
+  gridConf.deltaRMax = config.deltaRMax;
+  gridConf.cotThetaMax = config.cotThetaMax;
+
+  auto spacePoints = generateSpacePoints(nTracks, nNoise, config.bFieldInZ);
+  std::vector<const SpacePoint*> spacePointPtrs;
+  for (const auto& sp : spacePoints) {
+    spacePointPtrs.push_back(&sp);
+  }
+  auto covariance = [](const SpacePoint&, float, float, float) -> Vector2 {
+    return {0.01, 0.01};
+  };
+  auto spGroup = BinnedSPGroup<SpacePoint>(
+      spacePointPtrs.begin(), spacePointPtrs.end(), covariance,
+      std::make_shared<BinFinder<SpacePoint>>(),
+      std::make_shared<BinFinder<SpacePoint>>(),
+      SpacePointGridCreator::createGrid<SpacePoint>(gridConf), config);
+
+  ACTS_INFO("Seeding with " << spacePointPtrs.size() << " space points in "
+                            << spGroup.numGroups() << " groups");
+
+  // the pointer backend tests all candidates of the neighboring bins, the
+  // structure-of-arrays backend only the ones in the radius window
+  for (bool useSoABackend : {false, true}) {
+    config.useSoABackend = useSoABackend;
+    Seedfinder<SpacePoint> finder(config);
+    Seedfinder<SpacePoint>::State state;
+    std::vector<Seed<SpacePoint>> seeds;
+
+    auto runSeeding = [&] {
+      seeds.clear();
+      for (size_t igroup = 0; igroup < spGroup.numGroups(); ++igroup) {
+        auto group = spGroup.group(igroup);
+        finder.createSeedsForGroup(state, seeds, group.bottom(),
+                                   group.middle(), group.top());
+      }
+      return seeds.size();
+    };
+
+    // single pass to count the doublet candidates
+    state.numDoubletCandidates = 0;
+    runSeeding();
+    ACTS_INFO((useSoABackend ? "SoA" : "Pointer")
+              << " backend: " << seeds.size() << " seeds, "
+              << state.numDoubletCandidates << " doublet candidates tested");
+
+    const auto result = Acts::Test::microBenchmark(runSeeding, 1, runs);
+    ACTS_INFO("Execution stats: " << result);
+  }
+
+  return 0;
+}
@@ -16,12 +16,14 @@
 #include "Acts/Surfaces/CylinderSurface.hpp"
 #include "Acts/Surfaces/DiscSurface.hpp"
 #include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/PlaneSurfaceBatch.hpp"
 #include "Acts/Surfaces/RadialBounds.hpp"
 #include "Acts/Surfaces/RectangleBounds.hpp"
 #include "Acts/Surfaces/StrawSurface.hpp"
 #include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
 
 #include <cmath>
+#include <vector>
 
 namespace bdata = boost::unit_test::data;
 namespace tt = boost::test_tools;
@@ -38,6 +40,9 @@ const bool testPlane = true;
 const bool testDisc = true;
 const bool testCylinder = true;
 const bool testStraw = true;
+const bool testPlaneBatch = true;
+// Number of planes for the batched intersection
+unsigned int nplanes = 64;
 
 // Create a test context
 GeometryContext tgContext = GeometryContext();
@@ -68,6 +73,22 @@ Vector3 origin(0., 0., 0.);
 // The origin for straw/line attempts
 Vector3 originStraw(0.3_m, -0.2_m, 11_m);
 
+// A ring of planes in 10 m distance, e.g. the modules of a barrel layer
+std::vector<std::shared_ptr<PlaneSurface>> makePlaneRing() {
+  std::vector<std::shared_ptr<PlaneSurface>> planes;
+  auto ringBounds = std::make_shared<RectangleBounds>(0.5_m, 1_m);
+  for (unsigned int i = 0; i < nplanes; ++i) {
+    const double phi = 2 * M_PI * i / nplanes;
+    Vector3 center(10_m * std::cos(phi), 10_m * std::sin(phi), 0.);
+    Transform3 rt = Transform3::Identity() * Translation3(center) *
+                    AngleAxis3(phi, Vector3::UnitZ()) *
+                    AngleAxis3(0.5 * M_PI, Vector3::UnitY());
+    planes.push_back(Surface::makeShared<PlaneSurface>(rt, ringBounds));
+  }
+  return planes;
+}
+auto planeRing = makePlaneRing();
+
 template <typename surface_t>
 MicroBenchmarkResult intersectionTest(const surface_t& surface, double phi,
                                       double theta) {
@@ -86,6 +107,44 @@ MicroBenchmarkResult intersectionTest(const surface_t& surface, double phi,
       nrepts);
 }
 
+// Intersect all planes of the ring one by one or as a batch
+void batchIntersectionTest(double phi, double theta) {
+  Vector3 direction(std::cos(phi) * std::sin(theta),
+                    std::sin(phi) * std::sin(theta), std::cos(theta));
+
+  std::vector<const PlaneSurface*> planes;
+  for (const auto& plane : planeRing) {
+    planes.push_back(plane.get());
+  }
+  PlaneSurfaceBatch batch(tgContext, planes);
+  PlaneSurfaceBatch::Intersections intersections;
+
+  auto scalar = Acts::Test::microBenchmark(
+      [&] {
+        size_t nValid = 0;
+        for (const auto& plane : planeRing) {
+          nValid += plane->intersect(tgContext, origin, direction,
+                                     boundaryCheck)
+                        ? 1
+                        : 0;
+        }
+        return nValid;
+      },
+      nrepts);
+  auto batched = Acts::Test::microBenchmark(
+      [&] {
+        batch.intersect(origin, direction, boundaryCheck, intersections);
+        size_t nValid = 0;
+        for (auto status : intersections.status) {
+          nValid += (status != Intersection3D::Status::missed) ? 1 : 0;
+        }
+        return nValid;
+      },
+      nrepts);
+  std::cout << "- " << nplanes << " planes, scalar: " << scalar << std::endl;
+  std::cout << "- " << nplanes << " planes, batched: " << batched << std::endl;
+}
+
 BOOST_DATA_TEST_CASE(
     benchmark_surface_intersections,
     bdata::random(
@@ -120,6 +179,10 @@ BOOST_DATA_TEST_CASE(
               << intersectionTest<StrawSurface>(*aStraw, phi, theta + M_PI)
               << std::endl;
   }
+  if (testPlaneBatch) {
+    // the ring is placed around the z axis
+    batchIntersectionTest(phi, 0.5 * M_PI + theta);
+  }
 }
 
 }  // namespace Test
@@ -0,0 +1,82 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Material/SurfaceMaterialMapper.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+#include "Acts/Tests/CommonHelpers/PredefinedMaterials.hpp"
+
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Acts::UnitLiterals;
+
+int main(int argc, char* argv[]) {
+  size_t runs = 20;
+  size_t nTracks = 1000;
+  if (argc >= 2) {
+    runs = std::stoi(argv[1]);
+  }
+  if (argc >= 3) {
+    nTracks = std::stoi(argv[2]);
+  }
+
+  Acts::GeometryContext gctx;
+  Acts::MagneticFieldContext mctx;
+  Acts::Test::CylindricalTrackingGeometry cGeometry(gctx);
+  auto tGeometry = cGeometry();
+
+  Acts::Navigator navigator(tGeometry);
+  Acts::StraightLineStepper stepper;
+  Acts::SurfaceMaterialMapper::StraightLinePropagator propagator(
+      std::move(stepper), std::move(navigator));
+  Acts::SurfaceMaterialMapper mapper({}, std::move(propagator));
+  auto state = mapper.createState(gctx, mctx, *tGeometry);
+  std::cout << "Mapping onto " << state.accumulatedMaterial.size()
+            << " material surfaces" << std::endl;
+
+  // Tracks from the origin with a recorded material step every 2 mm up to
+  // the outermost layer, i.e. many steps are assigned to each surface
+  std::minstd_rand rng;
+  std::uniform_real_distribution<double> phiDist(-M_PI, M_PI);
+  std::uniform_real_distribution<double> etaDist(-1., 1.);
+  const Acts::MaterialSlab slab(Acts::Test::makeSilicon(), 0.1_mm);
+  std::vector<Acts::RecordedMaterialTrack> tracks;
+  for (size_t itrk = 0; itrk < nTracks; ++itrk) {
+    const double phi = phiDist(rng);
+    const double theta = 2. * std::atan(std::exp(-etaDist(rng)));
+    const Acts::Vector3 dir(std::cos(phi) * std::sin(theta),
+                            std::sin(phi) * std::sin(theta), std::cos(theta));
+    Acts::RecordedMaterial rMaterial;
+    for (double s = 2_mm; s * std::sin(theta) < 200_mm; s += 2_mm) {
+      Acts::MaterialInteraction mInteraction;
+      mInteraction.position = s * dir;
+      mInteraction.direction = dir;
+      mInteraction.materialSlab = slab;
+      rMaterial.materialInteractions.push_back(mInteraction);
+    }
+    tracks.push_back({{Acts::Vector3(0., 0., 0.), dir}, rMaterial});
+  }
+
+  size_t itrk = 0;
+  std::cout << "Benchmarking surface material mapping of " << nTracks
+            << " tracks: " << std::flush;
+  std::cout << Acts::Test::microBenchmark(
+                   [&] {
+                     auto& track = tracks[itrk++ % tracks.size()];
+                     mapper.mapMaterialTrack(state, track);
+                   },
+                   tracks.size(), runs)
+            << std::endl;
+}
@@ -777,4 +777,203 @@ BOOST_AUTO_TEST_CASE(TrackStateProxyCopy) {
                     &ts2.referenceSurface());  // always copied
 }
 
+BOOST_AUTO_TEST_CASE(ClearAndReuse) {
+  constexpr TrackStatePropMask kMask = TrackStatePropMask::Predicted;
+
+  MultiTrajectory<TestSourceLink> t;
+  // more states than the previous 16bit index could address
+  constexpr size_t kNumStates = 70000;
+  size_t tip = SIZE_MAX;
+  for (size_t i = 0; i < kNumStates; ++i) {
+    tip = t.addTrackState(kMask, tip);
+  }
+  BOOST_CHECK_EQUAL(t.size(), kNumStates);
+  BOOST_CHECK_EQUAL(t.getTrackState(tip).previous(), kNumStates - 2);
+
+  size_t n = 0;
+  t.visitBackwards(tip, [&](const auto&) { n++; });
+  BOOST_CHECK_EQUAL(n, kNumStates);
+
+  // the storage is kept and indices restart from zero
+  auto ts = t.getTrackState(0);
+  const auto* firstParams = ts.predicted().data();
+  t.clear();
+  BOOST_CHECK_EQUAL(t.size(), 0u);
+  auto i0 = t.addTrackState(kMask);
+  BOOST_CHECK_EQUAL(i0, 0u);
+  BOOST_CHECK_EQUAL(t.getTrackState(i0).predicted().data(), firstParams);
+  BOOST_CHECK_EQUAL(t.getTrackState(i0).previous(),
+                    detail_lt::IndexData::kInvalid);
+}
+
+BOOST_AUTO_TEST_CASE(FreeReferenceSurfaceOwnership) {
+  MultiTrajectory<TestSourceLink> t;
+  auto ts = t.getTrackState(t.addTrackState(TrackStatePropMask::Predicted));
+
+  // a free surface is kept alive by the trajectory
+  auto surface = Surface::makeShared<PlaneSurface>(Vector3::Zero(),
+                                                   Vector3::UnitZ());
+  std::weak_ptr<const Surface> weak = surface;
+  ts.setReferenceSurface(*surface);
+  surface.reset();
+  BOOST_CHECK(!weak.expired());
+  BOOST_CHECK_EQUAL(&ts.referenceSurface(), weak.lock().get());
+
+  // setting it again or copying it around does not retain extra owners
+  auto other = t.getTrackState(t.addTrackState(TrackStatePropMask::Predicted));
+  for (size_t i = 0; i < 3; ++i) {
+    ts.setReferenceSurface(*weak.lock());
+    other.copyFrom(ts, TrackStatePropMask::Predicted);
+  }
+  BOOST_CHECK_EQUAL(weak.use_count(), 2);
+
+  // and it is released once no slot references it anymore
+  auto replacement = Surface::makeShared<PlaneSurface>(Vector3::UnitX(),
+                                                       Vector3::UnitZ());
+  ts.setReferenceSurface(replacement);
+  BOOST_CHECK_EQUAL(weak.use_count(), 1);
+  other.setReferenceSurface(replacement);
+  BOOST_CHECK(weak.expired());
+
+  // free surfaces are released once the trajectory is cleared
+  std::weak_ptr<const Surface> weakReplacement = replacement;
+  replacement.reset();
+  BOOST_CHECK(!weakReplacement.expired());
+  t.clear();
+  BOOST_CHECK(weakReplacement.expired());
+}
+
+BOOST_DATA_TEST_CASE(CompactStorage, bd::make({1u, 2u}), nMeasurements) {
+  TestTrackState pc(rng, nMeasurements);
+
+  MultiTrajectory<TestSourceLink, CompactTrackStateStorage<ActsScalar>> t;
+  auto ts = t.getTrackState(t.addTrackState(TrackStatePropMask::All));
+  fillTrackState(pc, TrackStatePropMask::All, ts);
+
+  // covariances are reconstructed from the stored upper triangle. the input
+  // is only symmetric up to rounding.
+  CHECK_CLOSE_REL(ts.predictedCovariance(), *pc.predicted.covariance(), 1e-12);
+  CHECK_CLOSE_REL(ts.filteredCovariance(), *pc.filtered.covariance(), 1e-12);
+  CHECK_CLOSE_REL(ts.smoothedCovariance(), *pc.smoothed.covariance(), 1e-12);
+  BOOST_CHECK_EQUAL(ts.jacobian(), pc.jacobian);
+
+  // the measurement is only stored with its actual dimension
+  auto meas = TestSourceLinkCalibrator()(pc.sourceLink, nullptr);
+  std::visit(
+      [&](const auto& m) {
+        BOOST_CHECK_EQUAL(ts.calibratedSize(), nMeasurements);
+        BOOST_CHECK_EQUAL(ts.effectiveCalibrated(), m.parameters());
+        CHECK_CLOSE_REL(ts.effectiveCalibratedCovariance(), m.covariance(),
+                        1e-12);
+        BOOST_CHECK_EQUAL(ts.effectiveProjector(), m.projector());
+      },
+      meas);
+  auto cts = static_cast<const decltype(t)&>(t).getTrackState(ts.index());
+  BOOST_CHECK_EQUAL(cts.calibrated(), ts.calibrated());
+  BOOST_CHECK_EQUAL(cts.calibratedCovariance(), ts.calibratedCovariance());
+
+  // copy to and from the default storage
+  MultiTrajectory<TestSourceLink> full;
+  auto fts = full.getTrackState(full.addTrackState(TrackStatePropMask::All));
+  fts.copyFrom(ts);
+  BOOST_CHECK_EQUAL(fts.predictedCovariance(), ts.predictedCovariance());
+  BOOST_CHECK_EQUAL(fts.calibrated(), ts.calibrated());
+  BOOST_CHECK_EQUAL(fts.calibratedCovariance(), ts.calibratedCovariance());
+  BOOST_CHECK_EQUAL(fts.projector(), ts.projector());
+  auto ts2 = t.getTrackState(t.addTrackState(TrackStatePropMask::All));
+  ts2.copyFrom(fts);
+  BOOST_CHECK_EQUAL(ts2.smoothedCovariance(), ts.smoothedCovariance());
+  BOOST_CHECK_EQUAL(ts2.effectiveCalibratedCovariance(),
+                    ts.effectiveCalibratedCovariance());
+}
+
+BOOST_AUTO_TEST_CASE(CompactFloatStorage) {
+  TestTrackState pc(rng, 2u);
+
+  MultiTrajectory<TestSourceLink, CompactTrackStateStorage<float>> t;
+  auto ts = t.getTrackState(t.addTrackState(TrackStatePropMask::All));
+  fillTrackState(pc, TrackStatePropMask::All, ts);
+
+  // writing through a copy of the accessor updates the storage
+  auto cov = ts.filteredCovariance();
+  cov = *pc.predicted.covariance();
+  const auto& ref = *pc.predicted.covariance();
+  CHECK_CLOSE_REL(ts.filteredCovariance(), ref, 1e-6);
+  CHECK_CLOSE_REL(ts.predictedCovariance(), ref, 1e-6);
+  // the reconstructed covariance is exactly symmetric
+  BOOST_CHECK_EQUAL(ts.predictedCovariance(),
+                    ts.predictedCovariance().transpose());
+  // parameters are not affected by the reduced precision
+  BOOST_CHECK_EQUAL(ts.predicted(), pc.predicted.parameters());
+}
+
+BOOST_AUTO_TEST_CASE(CompactStorageCoefficientWrites) {
+  TestTrackState pc(rng, 2u);
+
+  MultiTrajectory<TestSourceLink, CompactTrackStateStorage<float>> t;
+  auto ts = t.getTrackState(t.addTrackState(TrackStatePropMask::All));
+  fillTrackState(pc, TrackStatePropMask::All, ts);
+
+  // single coefficients are written back through either triangle
+  ts.filteredCovariance()(eBoundLoc0, eBoundLoc1) = 0.5;
+  ts.filteredCovariance()(eBoundPhi, eBoundLoc0) = 0.25;
+  BOOST_CHECK_EQUAL(ts.filteredCovariance()(eBoundLoc1, eBoundLoc0), 0.5);
+  BOOST_CHECK_EQUAL(ts.filteredCovariance()(eBoundLoc0, eBoundPhi), 0.25);
+
+  // blocks are written back once the accessor goes out of scope
+  {
+    auto cov = ts.smoothedCovariance();
+    cov.topLeftCorner<2, 2>().setIdentity();
+  }
+  BOOST_CHECK_EQUAL((ts.smoothedCovariance().topLeftCorner<2, 2>()),
+                    (BoundSymMatrix::Identity().topLeftCorner<2, 2>()));
+
+  // an unmodified stale accessor does not overwrite newer values
+  {
+    auto stale = ts.predictedCovariance();
+    ts.predictedCovariance() = BoundSymMatrix::Identity();
+  }
+  BOOST_CHECK_EQUAL(ts.predictedCovariance(), BoundSymMatrix::Identity());
+
+  // the same applies to the measurement
+  ts.calibrated()(0) = 2.;
+  BOOST_CHECK_EQUAL(ts.effectiveCalibrated()(0), 2.);
+  ts.calibratedCovariance()(1, 0) = 3.;
+  BOOST_CHECK_EQUAL(ts.effectiveCalibratedCovariance()(0, 1), 3.);
+}
+
+BOOST_AUTO_TEST_CASE(CompactMeasurementStorageReuse) {
+  detail_lt::MeasurementStorage<eBoundSize, CompactTrackStateStorage<float>>
+      storage;
+  auto i0 = storage.add();
+  auto i1 = storage.add();
+  storage.resize(i0, 2);
+  storage.resize(i1, 3);
+  BOOST_CHECK_EQUAL(storage.parameters.size(), 5u);
+  BOOST_CHECK_EQUAL(storage.covariances.size(), 9u);
+
+  // shrinking and growing within the capacity keeps the storage
+  for (size_t i = 0; i < 3; ++i) {
+    storage.resize(i0, 1);
+    storage.resize(i0, 2);
+  }
+  BOOST_CHECK_EQUAL(storage.parameters.size(), 5u);
+  BOOST_CHECK_EQUAL(storage.covariances.size(), 9u);
+
+  // storage released by growing one measurement is reused by the next one
+  storage.resize(i0, 3);
+  BOOST_CHECK_EQUAL(storage.parameters.size(), 8u);
+  BOOST_CHECK_EQUAL(storage.covariances.size(), 15u);
+  auto i2 = storage.add();
+  storage.resize(i2, 2);
+  BOOST_CHECK_EQUAL(storage.parameters.size(), 8u);
+  BOOST_CHECK_EQUAL(storage.covariances.size(), 15u);
+  BOOST_CHECK_EQUAL(storage.entries[i2].iparameters, 0u);
+
+  // a resized measurement starts out empty
+  storage.parameters[storage.entries[i1].iparameters] = 1.;
+  storage.resize(i1, 2);
+  BOOST_CHECK_EQUAL(storage.parameters[storage.entries[i1].iparameters], 0.);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
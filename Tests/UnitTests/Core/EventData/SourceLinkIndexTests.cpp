@@ -0,0 +1,109 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/EventData/SourceLinkIndex.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Tests/CommonHelpers/TestSourceLink.hpp"
+
+#include <vector>
+
+using namespace Acts;
+using Acts::Test::TestSourceLink;
+
+namespace {
+
+TestSourceLink makeSourceLink(GeometryIdentifier geoId, size_t sourceId) {
+  return TestSourceLink(eBoundLoc0, 0., 1., geoId, sourceId);
+}
+
+const auto sensitive1 = GeometryIdentifier().setVolume(1).setSensitive(1);
+const auto sensitive2 = GeometryIdentifier().setVolume(1).setSensitive(2);
+const auto sensitive3 = GeometryIdentifier().setVolume(2).setSensitive(1);
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(EventDataSourceLinkIndex)
+
+BOOST_AUTO_TEST_CASE(Empty) {
+  SourceLinkIndex<TestSourceLink> index;
+
+  BOOST_CHECK(index.empty());
+  BOOST_CHECK_EQUAL(index.size(), 0u);
+  BOOST_CHECK(index.geometryIds().empty());
+  BOOST_CHECK(index.begin() == index.end());
+  BOOST_CHECK(index.find(sensitive1).empty());
+}
+
+BOOST_AUTO_TEST_CASE(Unsorted) {
+  std::vector<TestSourceLink> sourceLinks = {
+      makeSourceLink(sensitive3, 0), makeSourceLink(sensitive1, 1),
+      makeSourceLink(sensitive3, 2), makeSourceLink(sensitive1, 3),
+      makeSourceLink(sensitive1, 4),
+  };
+  SourceLinkIndex<TestSourceLink> index(sourceLinks);
+
+  BOOST_CHECK(not index.empty());
+  BOOST_CHECK_EQUAL(index.size(), sourceLinks.size());
+  BOOST_CHECK_EQUAL(index.geometryIds().size(), 2u);
+  BOOST_CHECK_EQUAL(index.geometryIds()[0], sensitive1);
+  BOOST_CHECK_EQUAL(index.geometryIds()[1], sensitive3);
+
+  // the input order on the same surface is preserved
+  auto range1 = index.find(sensitive1);
+  BOOST_CHECK_EQUAL(range1.size(), 3u);
+  BOOST_CHECK_EQUAL(range1[0].sourceId, 1u);
+  BOOST_CHECK_EQUAL(range1[1].sourceId, 3u);
+  BOOST_CHECK_EQUAL(range1[2].sourceId, 4u);
+  BOOST_CHECK_EQUAL(range1.front().sourceId, 1u);
+  for (const auto& sl : range1) {
+    BOOST_CHECK_EQUAL(sl.geometryId(), sensitive1);
+  }
+  auto range3 = index.find(sensitive3);
+  BOOST_CHECK_EQUAL(range3.size(), 2u);
+  BOOST_CHECK_EQUAL(range3[0].sourceId, 0u);
+  BOOST_CHECK_EQUAL(range3[1].sourceId, 2u);
+
+  // surfaces without source links, including ones in between
+  BOOST_CHECK(index.find(sensitive2).empty());
+  BOOST_CHECK(index.find(GeometryIdentifier().setVolume(3)).empty());
+
+  // iteration over all source links follows the geometry identifier order
+  GeometryIdentifier previous;
+  for (const auto& sl : index) {
+    BOOST_CHECK(not(sl.geometryId() < previous));
+    previous = sl.geometryId();
+  }
+}
+
+BOOST_AUTO_TEST_CASE(AssignReuse) {
+  std::vector<TestSourceLink> sourceLinks = {
+      makeSourceLink(sensitive1, 0),
+      makeSourceLink(sensitive2, 1),
+      makeSourceLink(sensitive2, 2),
+  };
+  SourceLinkIndex<TestSourceLink> index(sourceLinks);
+  BOOST_CHECK_EQUAL(index.find(sensitive2).size(), 2u);
+
+  index.clear();
+  BOOST_CHECK(index.empty());
+  BOOST_CHECK(index.geometryIds().empty());
+  BOOST_CHECK(index.find(sensitive2).empty());
+
+  // already sorted input
+  index.assign(sourceLinks.begin() + 1, sourceLinks.end());
+  BOOST_CHECK_EQUAL(index.size(), 2u);
+  BOOST_CHECK(index.find(sensitive1).empty());
+  auto range2 = index.find(sensitive2);
+  BOOST_CHECK_EQUAL(range2.size(), 2u);
+  BOOST_CHECK_EQUAL(range2[0].sourceId, 1u);
+  BOOST_CHECK_EQUAL(range2[1].sourceId, 2u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,131 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/Geometry/VolumeExtentPrune.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+
+#include <cmath>
+
+namespace Acts {
+namespace Test {
+
+using LineWindow = VolumeExtentPrune::LineWindow;
+
+GeometryContext tgContext = GeometryContext();
+
+BOOST_AUTO_TEST_SUITE(Geometry)
+
+BOOST_AUTO_TEST_CASE(LineWindowTest) {
+  // passing the closest approach to the z axis
+  LineWindow window(Vector3(100., -50., 10.), Vector3(0., 1., 0.), 0., 100.);
+  CHECK_CLOSE_ABS(window.rMin, 100., 1e-9);
+  CHECK_CLOSE_ABS(window.rMax, std::hypot(100., 50.), 1e-9);
+  CHECK_CLOSE_ABS(window.zMin, 10., 1e-9);
+  CHECK_CLOSE_ABS(window.zMax, 10., 1e-9);
+
+  // closest approach outside the path limits
+  LineWindow outward(Vector3(100., -50., 0.), Vector3(0., 1., 0.), 60., 100.);
+  CHECK_CLOSE_ABS(outward.rMin, std::hypot(100., 10.), 1e-9);
+
+  // along the z axis with unlimited path length
+  LineWindow axial(Vector3(0., 0., 0.), Vector3(0., 0., -1.), -1.,
+                   std::numeric_limits<double>::max());
+  CHECK_CLOSE_ABS(axial.rMin, 0., 1e-9);
+  CHECK_CLOSE_ABS(axial.rMax, 0., 1e-9);
+  CHECK_CLOSE_ABS(axial.zMax, 1., 1e-9);
+  BOOST_CHECK(std::isfinite(axial.zMin));
+  BOOST_CHECK_LT(axial.zMin, -1e300);
+}
+
+BOOST_AUTO_TEST_CASE(ExtentPruneTest) {
+  CylindricalTrackingGeometry cGeometry(tgContext);
+  auto tGeometry = cGeometry();
+
+  // pixel barrel volume with layers at 32, 72, 116, 172 mm
+  const Vector3 position(50., 0., 0.);
+  const TrackingVolume* volume =
+      tGeometry->lowestTrackingVolume(tgContext, position);
+  BOOST_REQUIRE_NE(volume, nullptr);
+  const VolumeExtentPrune* prune = volume->extentPrune();
+  BOOST_REQUIRE_NE(prune, nullptr);
+
+  NavigationOptions<Layer> options(forward, true, true, true, false);
+  const Vector3 direction(1., 0., 0.);
+
+  // the next layer is out of reach of a short step
+  options.pathLimit = 5.;
+  auto lIntersections =
+      volume->compatibleLayers(tgContext, position, direction, options);
+  BOOST_CHECK(lIntersections.empty());
+
+  // only the next layer within one layer spacing
+  options.pathLimit = 40.;
+  lIntersections =
+      volume->compatibleLayers(tgContext, position, direction, options);
+  BOOST_REQUIRE_EQUAL(lIntersections.size(), 1u);
+  BOOST_CHECK_LT(lIntersections[0].intersection.pathLength, 40.);
+
+  // every pruned layer must not have a valid intersection
+  options.pathLimit = std::numeric_limits<double>::max();
+  LineWindow window(position, direction, options.overstepLimit, 40.);
+  size_t nReachable = 0;
+  for (const auto& layer : volume->confinedLayers()->arrayObjects()) {
+    if (prune->mayReach(*layer, window)) {
+      ++nReachable;
+      continue;
+    }
+    auto sIntersection =
+        layer->surfaceOnApproach(tgContext, position, direction, options);
+    BOOST_CHECK(not sIntersection or
+                40. < sIntersection.intersection.pathLength);
+  }
+  BOOST_CHECK_LT(nReachable, volume->confinedLayers()->arrayObjects().size());
+
+  // the unlimited search finds all outer layers
+  auto allIntersections =
+      volume->compatibleLayers(tgContext, position, direction, options);
+  BOOST_CHECK_GT(allIntersections.size(), lIntersections.size());
+
+  // layers of other volumes share the layer identifiers, but are not pruned
+  const TrackingVolume* other =
+      tGeometry->lowestTrackingVolume(tgContext, Vector3(0., 0., 0.));
+  BOOST_REQUIRE_NE(other, volume);
+  for (const auto& layer : other->confinedLayers()->arrayObjects()) {
+    BOOST_CHECK(prune->mayReach(*layer, window));
+  }
+
+  // boundaries are looked up by their index in the volume; the far outer
+  // cylinder is out of reach of a short step
+  const auto& boundaries = volume->boundarySurfaces();
+  LineWindow shortStep(position, direction, 0., 5.);
+  size_t nPruned = 0;
+  for (size_t ib = 0; ib < boundaries.size(); ++ib) {
+    if (prune->mayReachBoundary(ib, shortStep)) {
+      continue;
+    }
+    ++nPruned;
+    auto sIntersection = boundaries[ib]->surfaceRepresentation().intersect(
+        tgContext, position, direction, true);
+    BOOST_CHECK(not sIntersection or
+                5. < std::abs(sIntersection.intersection.pathLength));
+  }
+  BOOST_CHECK_GT(nPruned, 0u);
+  BOOST_CHECK(prune->mayReachBoundary(boundaries.size(), shortStep));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
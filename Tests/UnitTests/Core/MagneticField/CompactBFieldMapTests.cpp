@@ -0,0 +1,130 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/MagneticField/BFieldMapUtils.hpp"
+#include "Acts/MagneticField/CompactBFieldMap.hpp"
+#include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+
+#include <random>
+#include <vector>
+
+namespace Acts {
+namespace Test {
+
+MagneticFieldContext mfContext = MagneticFieldContext();
+
+namespace {
+
+// linear in x, y and z such that the interpolation is exact
+Vector3 linearField(double x, double y, double z) {
+  return Vector3(0.5 * x - 0.2 * y + 1., 0.3 * z + 0.1 * x, 2. - 0.4 * y);
+}
+
+// build a cartesian field mapper with a number of points that is not a
+// multiple of the block size
+InterpolatedBFieldMapper<CompactBFieldMap<>::Grid_t> makeMapper() {
+  std::vector<double> xPos, yPos, zPos;
+  for (int i = 0; i < 7; ++i) {
+    xPos.push_back(-3. + i);
+  }
+  for (int i = 0; i < 5; ++i) {
+    yPos.push_back(-2. + i);
+  }
+  for (int i = 0; i < 10; ++i) {
+    zPos.push_back(-5. + i);
+  }
+  std::vector<Vector3> bField;
+  for (double x : xPos) {
+    for (double y : yPos) {
+      for (double z : zPos) {
+        bField.push_back(linearField(x, y, z));
+      }
+    }
+  }
+  auto localToGlobalBin = [](std::array<size_t, 3> bins,
+                             std::array<size_t, 3> nBins) {
+    return bins[0] * nBins[1] * nBins[2] + bins[1] * nBins[2] + bins[2];
+  };
+  return fieldMapperXYZ(localToGlobalBin, xPos, yPos, zPos, bField, 1., 1.);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(CompactBFieldMapTests)
+
+BOOST_AUTO_TEST_CASE(CompareToInterpolatedBFieldMap) {
+  auto mapper = makeMapper();
+  CompactBFieldMap<> compact(mapper.getGrid());
+  using BField_t = InterpolatedBFieldMap<decltype(mapper)>;
+  BField_t reference(BField_t::Config(std::move(mapper)));
+
+  BOOST_CHECK_EQUAL(compact.getNBins()[0], 7u);
+  BOOST_CHECK_EQUAL(compact.getNBins()[1], 5u);
+  BOOST_CHECK_EQUAL(compact.getNBins()[2], 10u);
+  CHECK_CLOSE_ABS(compact.getMin()[2], -5., 1e-12);
+  CHECK_CLOSE_ABS(compact.getMax()[2], 5., 1e-12);
+
+  CompactBFieldMap<>::Cache cache(mfContext);
+  BField_t::Cache referenceCache(mfContext);
+
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> xDist(-3., 4.);
+  std::uniform_real_distribution<double> yDist(-2., 3.);
+  std::uniform_real_distribution<double> zDist(-5., 5.);
+  for (int i = 0; i < 1000; ++i) {
+    const Vector3 pos(xDist(rng), yDist(rng), zDist(rng));
+    BOOST_CHECK_EQUAL(compact.isInside(pos), reference.isInside(pos));
+    if (not reference.isInside(pos)) {
+      continue;
+    }
+    const Vector3 expected = reference.getField(pos, referenceCache);
+    // single precision storage
+    CHECK_CLOSE_ABS(compact.getField(pos), expected, 1e-5);
+    CHECK_CLOSE_ABS(compact.getField(pos, cache), expected, 1e-5);
+    // the interpolation is exact inside the filled points
+    if (pos.x() <= 3. and pos.y() <= 2. and pos.z() <= 4.) {
+      CHECK_CLOSE_ABS(compact.getField(pos), linearField(pos.x(), pos.y(),
+                                                         pos.z()),
+                      1e-5);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(CacheAndDomain) {
+  auto mapper = makeMapper();
+  CompactBFieldMap<> compact(mapper.getGrid());
+  CompactBFieldMap<>::Cache cache(mfContext);
+
+  // moving within a cell and across cells updates the cached corners
+  const Vector3 first(0.25, 0.5, -1.5);
+  const Vector3 second(0.75, 0.5, -1.5);
+  const Vector3 third(2.5, -1.5, 3.5);
+  for (const auto& pos : {first, second, third, first}) {
+    CHECK_CLOSE_ABS(compact.getField(pos, cache),
+                    linearField(pos.x(), pos.y(), pos.z()), 1e-5);
+  }
+
+  BOOST_CHECK(compact.isInside(Vector3(-3., -2., -5.)));
+  BOOST_CHECK(not compact.isInside(Vector3(-3.1, 0., 0.)));
+  BOOST_CHECK(not compact.isInside(Vector3(0., 3., 0.)));
+  BOOST_CHECK(not compact.isInside(Vector3(0., 0., 5.)));
+
+  // positions outside are clamped to the closest cell
+  CHECK_CLOSE_ABS(compact.getField(Vector3(-10., 0., 0.)),
+                  linearField(-3., 0., 0.), 1e-5);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
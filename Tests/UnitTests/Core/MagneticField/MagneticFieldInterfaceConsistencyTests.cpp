@@ -14,6 +14,7 @@
 
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/Definitions/Units.hpp"
+#include "Acts/MagneticField/CompactBFieldMap.hpp"
 #include "Acts/MagneticField/ConstantBField.hpp"
 #include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
@@ -92,6 +93,18 @@ BOOST_AUTO_TEST_CASE(TestInterpolatedBFieldMapInterfaceConsistency) {
   testInterfaceConsistency(b);
 }
 
+BOOST_AUTO_TEST_CASE(TestCompactBFieldMapInterfaceConsistency) {
+  using Grid_t = CompactBFieldMap<>::Grid_t;
+  detail::EquidistantAxis axis(-1., 1., 2u);
+  Grid_t grid(std::make_tuple(axis, axis, axis));
+  for (size_t i = 0; i < grid.size(); ++i) {
+    grid.at(i) = Vector3::Zero();
+  }
+  CompactBFieldMap<> b(grid);
+
+  testInterfaceConsistency(b);
+}
+
 BOOST_AUTO_TEST_CASE(TestSharedBFieldInterfaceConsistency) {
   SharedBField<ConstantBField> field(
       std::make_shared<ConstantBField>(Vector3(1, 1, 1)));
@@ -194,4 +194,43 @@ BOOST_AUTO_TEST_CASE(MultipleDifferentTracks) {
   }
 }
 
+// merging independent accumulations is equivalent to a single accumulation
+BOOST_AUTO_TEST_CASE(MergeTracks) {
+  MaterialSlab unit = makeUnitSlab();
+  MaterialSlab three = unit;
+  three.scaleThickness(3);
+  MaterialSlab vac(2 * unit.thickness());
+  AccumulatedMaterialSlab all;
+  AccumulatedMaterialSlab first;
+  AccumulatedMaterialSlab second;
+  for (const auto& slab : {unit, three, vac}) {
+    all.accumulate(slab);
+    all.trackAverage();
+    first.accumulate(slab);
+    first.trackAverage();
+  }
+  all.accumulate(vac);
+  all.trackAverage();
+  second.accumulate(vac);
+  second.trackAverage();
+
+  // merging an empty accumulation does not change anything
+  AccumulatedMaterialSlab empty;
+  first.merge(empty);
+  BOOST_CHECK_EQUAL(first.totalAverage().second, 3u);
+  empty.merge(second);
+  BOOST_CHECK_EQUAL(empty.totalAverage().first, second.totalAverage().first);
+  BOOST_CHECK_EQUAL(empty.totalAverage().second, 1u);
+
+  first.merge(second);
+  auto [average, trackCount] = first.totalAverage();
+  auto [expected, expectedCount] = all.totalAverage();
+  BOOST_CHECK_EQUAL(trackCount, expectedCount);
+  CHECK_CLOSE_REL(average.thickness(), expected.thickness(), eps);
+  CHECK_CLOSE_REL(average.thicknessInX0(), expected.thicknessInX0(), 2 * eps);
+  CHECK_CLOSE_REL(average.material().X0(), expected.material().X0(), 2 * eps);
+  CHECK_CLOSE_REL(average.material().molarDensity(),
+                  expected.material().molarDensity(), 2 * eps);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -10,8 +10,10 @@
 
 #include "Acts/Material/AccumulatedSurfaceMaterial.hpp"
 #include "Acts/Material/ISurfaceMaterial.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 
 #include <climits>
+#include <stdexcept>
 
 namespace Acts {
 namespace Test {
@@ -119,5 +121,38 @@ BOOST_AUTO_TEST_CASE(AccumulatedSurfaceMaterial_fill_convert_1D) {
   BOOST_CHECK_EQUAL(trackCount11, 4u);
 }
 
+/// Test the merging of independent accumulations
+BOOST_AUTO_TEST_CASE(AccumulatedSurfaceMaterial_merge) {
+  Material mat = Material::fromMolarDensity(1., 1., 1., 1., 1.);
+  MaterialSlab one(mat, 1.);
+  MaterialSlab three(mat, 3.);
+
+  BinUtility binUtility2D(2, -1., 1., open, binX);
+  binUtility2D += BinUtility(2, -1., 1., open, binY);
+  AccumulatedSurfaceMaterial first{binUtility2D};
+  AccumulatedSurfaceMaterial second{binUtility2D};
+
+  first.accumulate(Vector2{-0.5, -0.5}, one);
+  first.trackAverage();
+  second.accumulate(Vector2{-0.5, -0.5}, three);
+  second.accumulate(Vector2{0.5, 0.5}, three);
+  second.trackAverage();
+  first.merge(second);
+
+  auto accMat2D = first.accumulatedMaterial();
+  auto [accMatProp00, trackCount00] = accMat2D[0][0].totalAverage();
+  auto [accMatProp01, trackCount01] = accMat2D[0][1].totalAverage();
+  auto [accMatProp11, trackCount11] = accMat2D[1][1].totalAverage();
+  BOOST_CHECK_EQUAL(trackCount00, 2u);
+  BOOST_CHECK_EQUAL(trackCount01, 0u);
+  BOOST_CHECK_EQUAL(trackCount11, 1u);
+  CHECK_CLOSE_REL(accMatProp00.thickness(), 2., 1e-6);
+  CHECK_CLOSE_REL(accMatProp11.thickness(), 3., 1e-6);
+
+  // different binnings can not be merged
+  AccumulatedSurfaceMaterial homogeneous;
+  BOOST_CHECK_THROW(first.merge(homogeneous), std::invalid_argument);
+}
+
 }  // namespace Test
 }  // namespace Acts
@@ -11,9 +11,12 @@
 
 #include "Acts/Definitions/Units.hpp"
 #include "Acts/Material/Interactions.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 #include "Acts/Tests/CommonHelpers/PredefinedMaterials.hpp"
 #include "Acts/Utilities/PdgParticle.hpp"
 
+#include <stdexcept>
+
 namespace data = boost::unit_test::data;
 using namespace Acts::UnitLiterals;
 
@@ -108,4 +111,73 @@ BOOST_DATA_TEST_CASE(vacuum, thickness* particle* momentum, x, i, m, q, p) {
                     0);
 }
 
+// tabulated interactions agree with the exact formulas
+BOOST_DATA_TEST_CASE(tabulated_consistency, thickness* particle* momentum, x,
+                     i, m, q, p) {
+  const auto slab = Acts::MaterialSlab(material, x);
+  const auto qOverP = q / p;
+  const Acts::InteractionsTable table({}, material, i, m, q);
+  // guaranteed at the midpoints, allow some margin elsewhere
+  const auto tol = 2 * table.maxRelativeError();
+
+  BOOST_CHECK_LE(table.maxRelativeError(), 1e-3);
+  auto dEBethe = computeEnergyLossBethe(slab, i, m, qOverP, q);
+  auto dELandau = computeEnergyLossLandau(slab, i, m, qOverP, q);
+  auto dELandauSigma = computeEnergyLossLandauSigma(slab, i, m, qOverP, q);
+  auto dELandauSigmaQOverP =
+      computeEnergyLossLandauSigmaQOverP(slab, i, m, qOverP, q);
+  auto dEMean = computeEnergyLossMean(slab, i, m, qOverP, q);
+  auto t0 = computeMultipleScatteringTheta0(slab, i, m, qOverP, q);
+
+  CHECK_CLOSE_REL(table.computeEnergyLossBethe(slab, qOverP), dEBethe, tol);
+  // the most probable value is accurate relative to the width
+  CHECK_CLOSE_ABS(table.computeEnergyLossLandau(slab, qOverP), dELandau,
+                  tol * dELandauSigma);
+  CHECK_CLOSE_REL(table.computeEnergyLossLandauSigma(slab, qOverP),
+                  dELandauSigma, tol);
+  CHECK_CLOSE_REL(table.computeEnergyLossLandauSigmaQOverP(slab, qOverP),
+                  dELandauSigmaQOverP, tol);
+  CHECK_CLOSE_REL(table.computeEnergyLossMean(slab, qOverP), dEMean, tol);
+  CHECK_CLOSE_REL(table.computeMultipleScatteringTheta0(slab, qOverP), t0,
+                  tol);
+}
+
+BOOST_AUTO_TEST_CASE(tabulated_range) {
+  const auto slab = Acts::MaterialSlab(material, 1_mm);
+  const auto vacuum = Acts::MaterialSlab(Acts::Material(), 1_mm);
+  Acts::InteractionsTable::Config cfg;
+  cfg.pMin = 1_GeV;
+  cfg.pMax = 10_GeV;
+  const Acts::InteractionsTable table(cfg, material, Acts::eMuon, 105.7_MeV);
+
+  // outside of the tabulated range the exact formulas are used
+  for (auto p : {500_MeV, 20_GeV}) {
+    const auto qOverP = 1_e / p;
+    BOOST_CHECK_EQUAL(
+        table.computeEnergyLossBethe(slab, qOverP),
+        computeEnergyLossBethe(slab, Acts::eMuon, 105.7_MeV, qOverP));
+    BOOST_CHECK_EQUAL(
+        table.computeMultipleScatteringTheta0(slab, qOverP),
+        computeMultipleScatteringTheta0(slab, Acts::eMuon, 105.7_MeV, qOverP));
+  }
+  BOOST_CHECK_EQUAL(table.computeEnergyLossBethe(vacuum, 1_e / 2_GeV), 0);
+  BOOST_CHECK_EQUAL(table.computeMultipleScatteringTheta0(vacuum, 1_e / 2_GeV),
+                    0);
+
+  // invalid configurations
+  cfg.pMin = 10_GeV;
+  BOOST_CHECK_THROW(
+      Acts::InteractionsTable(cfg, material, Acts::eMuon, 105.7_MeV),
+      std::invalid_argument);
+  cfg.pMin = 1_GeV;
+  cfg.maxPoints = 16;
+  cfg.tolerance = 1e-7f;
+  BOOST_CHECK_THROW(
+      Acts::InteractionsTable(cfg, material, Acts::eMuon, 105.7_MeV),
+      std::invalid_argument);
+  BOOST_CHECK_THROW(
+      Acts::InteractionsTable({}, Acts::Material(), Acts::eMuon, 105.7_MeV),
+      std::invalid_argument);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -23,11 +23,19 @@
 #include "Acts/Material/MaterialSlab.hpp"
 #include "Acts/Material/ProtoSurfaceMaterial.hpp"
 #include "Acts/Material/SurfaceMaterialMapper.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Tests/CommonHelpers/PredefinedMaterials.hpp"
+
+#include <cmath>
+#include <vector>
 
 namespace Acts {
 
 /// @brief create a small tracking geometry to map some dummy material on
-std::shared_ptr<const TrackingGeometry> trackingGeometry() {
+///
+/// @param middleLayerMaterial Whether the middle layer carries material
+std::shared_ptr<const TrackingGeometry> trackingGeometry(
+    bool middleLayerMaterial = true) {
   using namespace Acts::UnitLiterals;
 
   BinUtility zbinned(8, -40, 40, open, binZ);
@@ -66,7 +74,8 @@ std::shared_ptr<const TrackingGeometry> trackingGeometry() {
   layerBuilderConfig.centralLayerRadii = {10., 20., 30.};
   layerBuilderConfig.centralLayerHalflengthZ = {40., 40., 40.};
   layerBuilderConfig.centralLayerThickness = {1., 1., 1.};
-  layerBuilderConfig.centralLayerMaterial = {matProxy, matProxy, matProxy};
+  layerBuilderConfig.centralLayerMaterial = {
+      matProxy, middleLayerMaterial ? matProxy : nullptr, matProxy};
   auto layerBuilder = std::make_shared<const PassiveLayerBuilder>(
       layerBuilderConfig,
       getDefaultLogger("CentralBarrelBuilder", layerLLevel));
@@ -117,6 +126,146 @@ BOOST_AUTO_TEST_CASE(SurfaceMaterialMapper_tests) {
 
   /// Test if this is not null
   BOOST_CHECK_EQUAL(mState.accumulatedMaterial.size(), 3u);
+
+  /// The material surfaces have dense slots sorted by geometry ID
+  BOOST_CHECK_EQUAL(mState.slotIds.size(), 3u);
+  BOOST_CHECK_EQUAL(mState.slotMaterial.size(), 3u);
+  BOOST_CHECK_EQUAL(mState.assignedMaterial.size(), 3u);
+  size_t slot = 0;
+  for (auto& [geoID, accMaterial] : mState.accumulatedMaterial) {
+    BOOST_CHECK_EQUAL(mState.slotIds[slot], geoID);
+    BOOST_CHECK_EQUAL(mState.slotMaterial[slot], &accMaterial);
+    ++slot;
+  }
+}
+
+/// Test that tracks mapped into separate states can be merged
+BOOST_AUTO_TEST_CASE(SurfaceMaterialMapper_merge_tests) {
+  Navigator navigator(tGeometry);
+  StraightLineStepper stepper;
+  SurfaceMaterialMapper::StraightLinePropagator propagator(
+      std::move(stepper), std::move(navigator));
+  SurfaceMaterialMapper::Config smmConfig;
+  SurfaceMaterialMapper smMapper(smmConfig, std::move(propagator));
+
+  GeometryContext gCtx;
+  MagneticFieldContext mfCtx;
+
+  /// Tracks from the origin with one step on each layer
+  std::vector<RecordedMaterialTrack> tracks;
+  for (double slope : {-0.8, -0.3, 0.1, 0.5, 0.9, 1.1}) {
+    Vector3 dir = Vector3(1., 0., slope).normalized();
+    RecordedMaterial rMaterial;
+    for (double r : {10., 20., 30.}) {
+      MaterialInteraction mInteraction;
+      mInteraction.position = Vector3(r, 0., slope * r);
+      mInteraction.direction = dir;
+      mInteraction.materialSlab = MaterialSlab(makeSilicon(), r / 10.);
+      rMaterial.materialInteractions.push_back(mInteraction);
+    }
+    tracks.push_back({{Vector3(0., 0., 0.), dir}, rMaterial});
+  }
+
+  /// Map all tracks into one state and half of them into each of two states
+  auto allState = smMapper.createState(gCtx, mfCtx, *tGeometry);
+  auto firstState = smMapper.createState(gCtx, mfCtx, *tGeometry);
+  auto secondState = smMapper.createState(gCtx, mfCtx, *tGeometry);
+  for (size_t itrk = 0; itrk < tracks.size(); ++itrk) {
+    auto track = tracks[itrk];
+    smMapper.mapMaterialTrack(allState, track);
+    auto halfTrack = tracks[itrk];
+    smMapper.mapMaterialTrack(itrk % 2 ? secondState : firstState, halfTrack);
+  }
+  smMapper.mergeStates(firstState, std::move(secondState));
+
+  /// The per-track bookkeeping is reset after each track
+  for (unsigned int hits : allState.assignedMaterial) {
+    BOOST_CHECK_EQUAL(hits, 0u);
+  }
+
+  BOOST_CHECK_EQUAL(firstState.accumulatedMaterial.size(),
+                    allState.accumulatedMaterial.size());
+  size_t mappedTracks = 0;
+  for (auto& [geoID, accMaterial] : allState.accumulatedMaterial) {
+    const auto& expected = accMaterial.accumulatedMaterial();
+    const auto& merged =
+        firstState.accumulatedMaterial.at(geoID).accumulatedMaterial();
+    BOOST_CHECK_EQUAL(merged.size(), expected.size());
+    for (size_t ib1 = 0; ib1 < expected.size(); ++ib1) {
+      for (size_t ib0 = 0; ib0 < expected[ib1].size(); ++ib0) {
+        auto [slab, trackCount] = expected[ib1][ib0].totalAverage();
+        auto [mergedSlab, mergedCount] = merged[ib1][ib0].totalAverage();
+        BOOST_CHECK_EQUAL(mergedCount, trackCount);
+        if (trackCount > 0) {
+          CHECK_CLOSE_REL(mergedSlab.thicknessInX0(), slab.thicknessInX0(),
+                          1e-5);
+        }
+        mappedTracks += trackCount;
+      }
+    }
+  }
+  BOOST_CHECK_GT(mappedTracks, 0u);
+}
+
+/// Test that material steps on surfaces without a slot in the state are not
+/// mapped, neither onto that surface nor onto a neighbouring one
+BOOST_AUTO_TEST_CASE(SurfaceMaterialMapper_missing_slot_tests) {
+  Navigator navigator(tGeometry);
+  StraightLineStepper stepper;
+  SurfaceMaterialMapper::StraightLinePropagator propagator(
+      std::move(stepper), std::move(navigator));
+  SurfaceMaterialMapper::Config smmConfig;
+  SurfaceMaterialMapper smMapper(smmConfig, std::move(propagator));
+
+  GeometryContext gCtx;
+  MagneticFieldContext mfCtx;
+
+  /// The state misses the middle layer, which the navigation still finds
+  auto partialGeometry = trackingGeometry(false);
+  auto mState = smMapper.createState(gCtx, mfCtx, *partialGeometry);
+  BOOST_CHECK_EQUAL(mState.slotIds.size(), 2u);
+
+  /// One track with a step on each layer
+  Vector3 dir = Vector3(1., 0., 0.1).normalized();
+  RecordedMaterial rMaterial;
+  for (double r : {10., 20., 30.}) {
+    MaterialInteraction mInteraction;
+    mInteraction.position = Vector3(r, 0., 0.1 * r);
+    mInteraction.direction = dir;
+    mInteraction.materialSlab = MaterialSlab(makeSilicon(), r / 10.);
+    rMaterial.materialInteractions.push_back(mInteraction);
+  }
+  RecordedMaterialTrack track = {{Vector3(0., 0., 0.), dir}, rMaterial};
+  smMapper.mapMaterialTrack(mState, track);
+
+  const auto& steps = track.second.materialInteractions;
+  BOOST_CHECK(steps[0].surface != nullptr);
+  BOOST_CHECK(steps[1].surface == nullptr);
+  BOOST_CHECK(steps[2].surface != nullptr);
+
+  /// The remaining layers took the same material as with a complete state
+  auto fullState = smMapper.createState(gCtx, mfCtx, *tGeometry);
+  RecordedMaterialTrack fullTrack = {{Vector3(0., 0., 0.), dir}, rMaterial};
+  smMapper.mapMaterialTrack(fullState, fullTrack);
+  for (auto& [geoID, accMaterial] : mState.accumulatedMaterial) {
+    const auto& mapped = accMaterial.accumulatedMaterial();
+    const auto& expected =
+        fullState.accumulatedMaterial.at(geoID).accumulatedMaterial();
+    size_t mappedTracks = 0;
+    for (size_t ib1 = 0; ib1 < expected.size(); ++ib1) {
+      for (size_t ib0 = 0; ib0 < expected[ib1].size(); ++ib0) {
+        auto [slab, trackCount] = expected[ib1][ib0].totalAverage();
+        auto [mappedSlab, mappedCount] = mapped[ib1][ib0].totalAverage();
+        BOOST_CHECK_EQUAL(mappedCount, trackCount);
+        if (trackCount > 0) {
+          CHECK_CLOSE_REL(mappedSlab.thicknessInX0(), slab.thicknessInX0(),
+                          1e-5);
+        }
+        mappedTracks += mappedCount;
+      }
+    }
+    BOOST_CHECK_EQUAL(mappedTracks, 1u);
+  }
 }
 
 }  // namespace Test
@@ -69,8 +69,8 @@ struct MaterialCollector {
 
 namespace Test {
 
-/// Test the filling and conversion
-BOOST_AUTO_TEST_CASE(SurfaceMaterialMapper_tests) {
+/// @brief Three cuboid volumes along x with binned proto volume material
+std::shared_ptr<const TrackingGeometry> protoMaterialGeometry() {
   using namespace Acts::UnitLiterals;
 
   BinUtility bu1(4, 0_m, 1_m, open, binX);
@@ -122,7 +122,35 @@ BOOST_AUTO_TEST_CASE(SurfaceMaterialMapper_tests) {
         return cvb.trackingVolume(context, inner, nullptr);
       });
   TrackingGeometryBuilder tgb(tgbCfg);
-  std::shared_ptr<const TrackingGeometry> tGeometry = tgb.trackingGeometry(gc);
+  return tgb.trackingGeometry(gc);
+}
+
+/// @brief Straight tracks along x from the first to the last volume with a
+/// silicon step at the center of each volume
+std::vector<RecordedMaterialTrack> materialTracks() {
+  using namespace Acts::UnitLiterals;
+
+  std::vector<RecordedMaterialTrack> tracks;
+  for (double slope : {-0.2, -0.1, 0., 0.1, 0.2}) {
+    Vector3 dir = Vector3(1., slope, -slope).normalized();
+    RecordedMaterial rMaterial;
+    for (double x : {0.5_m, 1.5_m, 2.5_m}) {
+      MaterialInteraction mInteraction;
+      mInteraction.position = Vector3(x, slope * x, -slope * x);
+      mInteraction.direction = dir;
+      mInteraction.materialSlab = MaterialSlab(makeSilicon(), 1_mm);
+      rMaterial.materialInteractions.push_back(mInteraction);
+    }
+    tracks.push_back({{Vector3(1_mm, 0., 0.), dir}, rMaterial});
+  }
+  return tracks;
+}
+
+/// Test the filling and conversion
+BOOST_AUTO_TEST_CASE(SurfaceMaterialMapper_tests) {
+  using namespace Acts::UnitLiterals;
+
+  std::shared_ptr<const TrackingGeometry> tGeometry = protoMaterialGeometry();
 
   /// We need a Navigator, Stepper to build a Propagator
   Navigator navigator(tGeometry);
@@ -145,6 +173,117 @@ BOOST_AUTO_TEST_CASE(SurfaceMaterialMapper_tests) {
 
   /// Test if this is not null
   BOOST_CHECK_EQUAL(mState.recordedMaterial.size(), 3u);
+
+  /// The recorded points of independent states are concatenated
+  auto otherState = vmMapper.createState(gCtx, mfCtx, *tGeometry);
+  const GeometryIdentifier geoID = mState.recordedMaterial.begin()->first;
+  RecordedMaterialVolumePoint points = {
+      {MaterialSlab(makeSilicon(), 1_mm), {Vector3(0.5_m, 0., 0.)}}};
+  mState.recordedMaterial[geoID] = points;
+  otherState.recordedMaterial[geoID] = points;
+  vmMapper.mergeStates(mState, std::move(otherState));
+  BOOST_CHECK_EQUAL(mState.recordedMaterial.size(), 3u);
+  BOOST_CHECK_EQUAL(mState.recordedMaterial[geoID].size(), 2u);
+  BOOST_CHECK_EQUAL(mState.materialBin.size(), 3u);
+}
+
+/// Test that tracks mapped into separate states can be merged
+BOOST_AUTO_TEST_CASE(VolumeMaterialMapper_merge_tests) {
+  std::shared_ptr<const TrackingGeometry> tGeometry = protoMaterialGeometry();
+  Navigator navigator(tGeometry);
+  StraightLineStepper stepper;
+  VolumeMaterialMapper::StraightLinePropagator propagator(std::move(stepper),
+                                                          std::move(navigator));
+  VolumeMaterialMapper::Config vmmConfig;
+  VolumeMaterialMapper vmMapper(vmmConfig, std::move(propagator));
+
+  GeometryContext gCtx;
+  MagneticFieldContext mfCtx;
+
+  /// Map all tracks into one state and half of them into each of two states
+  auto tracks = materialTracks();
+  auto allState = vmMapper.createState(gCtx, mfCtx, *tGeometry);
+  auto firstState = vmMapper.createState(gCtx, mfCtx, *tGeometry);
+  auto secondState = vmMapper.createState(gCtx, mfCtx, *tGeometry);
+  for (size_t itrk = 0; itrk < tracks.size(); ++itrk) {
+    auto track = tracks[itrk];
+    vmMapper.mapMaterialTrack(allState, track);
+    auto halfTrack = tracks[itrk];
+    vmMapper.mapMaterialTrack(itrk % 2 ? secondState : firstState, halfTrack);
+  }
+  vmMapper.mergeStates(firstState, std::move(secondState));
+
+  /// The merged state holds the same points, in a different order
+  BOOST_CHECK_EQUAL(firstState.recordedMaterial.size(),
+                    allState.recordedMaterial.size());
+  BOOST_CHECK_EQUAL(firstState.materialBin.size(),
+                    allState.materialBin.size());
+  size_t mappedPoints = 0;
+  for (auto& [geoID, expected] : allState.recordedMaterial) {
+    const auto& merged = firstState.recordedMaterial.at(geoID);
+    BOOST_CHECK_EQUAL(merged.size(), expected.size());
+    double expectedThickness = 0., mergedThickness = 0.;
+    size_t expectedPositions = 0, mergedPositions = 0;
+    for (const auto& [slab, positions] : expected) {
+      expectedThickness += slab.thickness() * positions.size();
+      expectedPositions += positions.size();
+    }
+    for (const auto& [slab, positions] : merged) {
+      mergedThickness += slab.thickness() * positions.size();
+      mergedPositions += positions.size();
+    }
+    BOOST_CHECK_EQUAL(mergedPositions, expectedPositions);
+    CHECK_CLOSE_REL(mergedThickness, expectedThickness, 1e-6);
+    mappedPoints += expectedPositions;
+  }
+  BOOST_CHECK_GT(mappedPoints, 0u);
+}
+
+/// Test that each material step is mapped once, into the volume it is in
+BOOST_AUTO_TEST_CASE(VolumeMaterialMapper_single_pass_tests) {
+  using namespace Acts::UnitLiterals;
+
+  std::shared_ptr<const TrackingGeometry> tGeometry = protoMaterialGeometry();
+  Navigator navigator(tGeometry);
+  StraightLineStepper stepper;
+  VolumeMaterialMapper::StraightLinePropagator propagator(std::move(stepper),
+                                                          std::move(navigator));
+  VolumeMaterialMapper::Config vmmConfig;
+  VolumeMaterialMapper vmMapper(vmmConfig, std::move(propagator));
+
+  GeometryContext gCtx;
+  MagneticFieldContext mfCtx;
+
+  auto mState = vmMapper.createState(gCtx, mfCtx, *tGeometry);
+  auto track = materialTracks()[2];
+  vmMapper.mapMaterialTrack(mState, track);
+
+  /// The steps are associated to three different volumes
+  const auto& steps = track.second.materialInteractions;
+  BOOST_CHECK_EQUAL(steps.size(), 3u);
+  for (size_t istep = 0; istep < steps.size(); ++istep) {
+    BOOST_REQUIRE(steps[istep].volume != nullptr);
+    BOOST_CHECK(steps[istep].volume->inside(steps[istep].position));
+    if (istep > 0) {
+      BOOST_CHECK(not(steps[istep].volume->geometryId() ==
+                      steps[istep - 1].volume->geometryId()));
+    }
+  }
+
+  /// Every volume holds the points of its own step once, and the vacuum in
+  /// between does not exceed the length of the volume
+  for (auto& [geoID, recMaterial] : mState.recordedMaterial) {
+    size_t siliconPoints = 0;
+    double thickness = 0.;
+    for (const auto& [slab, positions] : recMaterial) {
+      if (slab.material()) {
+        siliconPoints += positions.size();
+      }
+      thickness += slab.thickness() * positions.size();
+    }
+    BOOST_CHECK_EQUAL(siliconPoints, 1u);
+    BOOST_CHECK_LE(thickness, 1_m + 1_mm);
+  }
 }
 
 /// @brief Test case for comparison between the mapped material and the
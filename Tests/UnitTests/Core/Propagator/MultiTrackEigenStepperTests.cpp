@@ -0,0 +1,152 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/NeutralTrackParameters.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/EigenStepperError.hpp"
+#include "Acts/Propagator/MultiTrackEigenStepper.hpp"
+#include "Acts/Propagator/MultiTrackPropagator.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/PropagatorError.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+
+#include <vector>
+
+namespace Acts {
+namespace Test {
+
+using namespace Acts::UnitLiterals;
+
+GeometryContext tgContext = GeometryContext();
+MagneticFieldContext mfContext = MagneticFieldContext();
+
+using MultiStepper = MultiTrackEigenStepper<ConstantBField, 4>;
+using MultiPropagator = MultiTrackPropagator<MultiStepper>;
+
+namespace {
+
+std::vector<CurvilinearTrackParameters> makeTracks() {
+  std::vector<CurvilinearTrackParameters> tracks;
+  // more tracks than lanes such that the last group is partially filled
+  for (int i = 0; i < 7; ++i) {
+    const double phi = -2. + 0.6 * i;
+    const double theta = 0.6 + 0.3 * i;
+    const Vector3 dir(std::cos(phi) * std::sin(theta),
+                      std::sin(phi) * std::sin(theta), std::cos(theta));
+    const Vector4 pos4(0.1 * i, -0.2 * i, 1. * i, 0.);
+    const double charge = (i % 2 == 0) ? 1. : -1.;
+    const double p = 0.4_GeV + 0.5_GeV * i;
+    tracks.emplace_back(pos4, dir, charge / p);
+  }
+  return tracks;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(MultiTrackEigenStepperTests)
+
+BOOST_AUTO_TEST_CASE(CompareToEigenStepper) {
+  const Vector3 bField(0.1_T, -0.2_T, 2_T);
+  const auto tracks = makeTracks();
+
+  // reference propagation track by track
+  using Stepper = EigenStepper<ConstantBField>;
+  Stepper stepper(ConstantBField{bField});
+  Propagator<Stepper> propagator(std::move(stepper));
+  PropagatorOptions<> options(tgContext, mfContext, getDummyLogger());
+  options.pathLimit = 2_m;
+  options.maxStepSize = 50_cm;
+
+  MultiStepper multiStepper(ConstantBField{bField});
+  MultiPropagator multiPropagator(std::move(multiStepper));
+  MultiPropagator::Options multiOptions;
+  multiOptions.pathLimit = options.pathLimit;
+  multiOptions.maxStepSize = options.maxStepSize;
+  multiOptions.stepping.tolerance = options.tolerance;
+  multiOptions.stepping.mass = options.mass;
+
+  auto results =
+      multiPropagator.propagate(tgContext, mfContext, tracks, multiOptions);
+  BOOST_REQUIRE_EQUAL(results.size(), tracks.size());
+
+  for (size_t i = 0; i < tracks.size(); ++i) {
+    auto reference = propagator.propagate(tracks[i], options);
+    BOOST_REQUIRE(reference.ok());
+    BOOST_REQUIRE(results[i].ok());
+    const auto& refPars = *reference.value().endParameters;
+    const auto& result = results[i].value();
+    const FreeVector& pars = result.endParameters;
+
+    CHECK_CLOSE_ABS(result.pathLength, reference.value().pathLength, 1e-6);
+    BOOST_CHECK_GT(result.steps, 1u);
+    CHECK_SMALL((pars.segment<3>(eFreePos0) - refPars.position(tgContext))
+                    .norm(),
+                1e-6);
+    CHECK_SMALL((pars.segment<3>(eFreeDir0) - refPars.unitDirection()).norm(),
+                1e-9);
+    CHECK_CLOSE_REL(pars[eFreeTime], refPars.time(), 1e-9);
+    CHECK_CLOSE_REL(pars[eFreeQOverP], refPars.parameters()[eBoundQOverP],
+                    1e-12);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(MaskedLanes) {
+  const Vector3 bField(0., 0., 2_T);
+  MultiStepper multiStepper(ConstantBField{bField});
+  MultiPropagator multiPropagator(std::move(multiStepper));
+  MultiPropagator::Options multiOptions;
+  multiOptions.pathLimit = 5_m;
+  multiOptions.maxStepSize = 10_m;
+  // any step size reduction stalls the lane
+  multiOptions.stepping.stepSizeCutOff = 1_m;
+
+  const Vector4 pos4(0., 0., 0., 0.);
+  const Vector3 dir(1., 0., 0.);
+  std::vector<NeutralCurvilinearTrackParameters> neutral = {
+      NeutralCurvilinearTrackParameters(pos4, dir, 1. / 1_GeV)};
+  std::vector<CurvilinearTrackParameters> charged = {
+      CurvilinearTrackParameters(pos4, dir, 1. / 100_MeV),
+      CurvilinearTrackParameters(pos4, dir, 1. / 1_GeV)};
+
+  // neutral tracks move straight to the limit in a single step
+  auto neutralResults =
+      multiPropagator.propagate(tgContext, mfContext, neutral, multiOptions);
+  BOOST_REQUIRE(neutralResults[0].ok());
+  BOOST_CHECK_EQUAL(neutralResults[0].value().steps, 1u);
+  CHECK_CLOSE_ABS(neutralResults[0].value().endParameters[eFreePos0], 5_m,
+                  1e-9);
+
+  // the charged tracks can not be stepped and are stopped individually
+  auto chargedResults =
+      multiPropagator.propagate(tgContext, mfContext, charged, multiOptions);
+  for (auto& result : chargedResults) {
+    BOOST_CHECK(result.error() == EigenStepperError::StepSizeStalled);
+  }
+
+  // a step limit stops all lanes
+  multiOptions.stepping.stepSizeCutOff = 0.;
+  multiOptions.maxSteps = 2;
+  chargedResults =
+      multiPropagator.propagate(tgContext, mfContext, charged, multiOptions);
+  for (auto& result : chargedResults) {
+    BOOST_CHECK(result.error() == PropagatorError::StepCountLimitReached);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
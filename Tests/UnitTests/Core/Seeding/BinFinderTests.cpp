@@ -0,0 +1,55 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Seeding/BinFinder.hpp"
+#include "Acts/Seeding/SpacePointGrid.hpp"
+
+#include <vector>
+
+#include "SpacePoint.hpp"
+
+namespace Acts {
+namespace Test {
+
+BOOST_AUTO_TEST_SUITE(Seeding)
+
+BOOST_AUTO_TEST_CASE(BinFinderNeighborhood) {
+  using Grid_t = SpacePointGrid<SpacePoint>;
+  using PhiAxis = detail::Axis<detail::AxisType::Equidistant,
+                               detail::AxisBoundaryType::Closed>;
+  using ZAxis = detail::Axis<detail::AxisType::Equidistant,
+                             detail::AxisBoundaryType::Bound>;
+  // 5 bins in phi and 4 bins in z, 7 x 6 bins including under-/overflow
+  Grid_t grid(std::make_tuple(PhiAxis(-M_PI, M_PI, 5u), ZAxis(-2., 2., 4u)));
+  BinFinder<SpacePoint> finder;
+
+  // the closed phi axis wraps around, the bound z axis is cut
+  using bins_t = std::vector<size_t>;
+  auto findBins = [&](size_t phiBin, size_t zBin) {
+    const auto bins = finder.findBins(phiBin, zBin, &grid);
+    return bins_t(bins.begin(), bins.end());
+  };
+  BOOST_CHECK(findBins(1, 1) == bins_t({31, 32, 7, 8, 13, 14}));
+  BOOST_CHECK(findBins(3, 2) == bins_t({13, 14, 15, 19, 20, 21, 25, 26, 27}));
+  BOOST_CHECK(findBins(5, 4) == bins_t({27, 28, 33, 34, 9, 10}));
+
+  // identical to the generic grid neighborhood
+  for (size_t phiBin = 1; phiBin <= 5; ++phiBin) {
+    for (size_t zBin = 1; zBin <= 4; ++zBin) {
+      BOOST_CHECK(findBins(phiBin, zBin) ==
+                  grid.neighborHoodIndices({{phiBin, zBin}}, 1).collect());
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
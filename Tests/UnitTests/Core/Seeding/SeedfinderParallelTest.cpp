@@ -0,0 +1,104 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Seeding/Seed.hpp"
+#include "Acts/Seeding/Seedfinder.hpp"
+#include "Acts/Utilities/SequentialExecutor.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include "SeedingTestHelpers.hpp"
+#include "SpacePoint.hpp"
+
+namespace {
+
+using namespace Acts;
+
+using SeedsPerGroup = std::vector<std::vector<Seed<SpacePoint>>>;
+
+/// Executor that processes fixed-size chunks in reverse order on separate
+/// threads to check that the result does not depend on the execution order.
+struct ReverseThreadedExecutor {
+  size_t chunkSize = 7;
+
+  void operator()(size_t nItems,
+                  const std::function<void(size_t, size_t)>& task) const {
+    std::vector<std::thread> threads;
+    size_t nChunks = (nItems + chunkSize - 1) / chunkSize;
+    for (size_t ichunk = nChunks; 0 < ichunk; --ichunk) {
+      size_t begin = (ichunk - 1) * chunkSize;
+      size_t end = std::min(begin + chunkSize, nItems);
+      threads.emplace_back(task, begin, end);
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+};
+
+void checkEqual(const SeedsPerGroup& a, const SeedsPerGroup& b) {
+  BOOST_REQUIRE_EQUAL(a.size(), b.size());
+  for (size_t igroup = 0; igroup < a.size(); ++igroup) {
+    BOOST_REQUIRE_EQUAL(a[igroup].size(), b[igroup].size());
+    for (size_t iseed = 0; iseed < a[igroup].size(); ++iseed) {
+      BOOST_CHECK(a[igroup][iseed].sp() == b[igroup][iseed].sp());
+      BOOST_CHECK_EQUAL(a[igroup][iseed].z(), b[igroup][iseed].z());
+    }
+  }
+}
+
+}  // namespace
+
+namespace Acts {
+namespace Test {
+
+BOOST_AUTO_TEST_SUITE(Seeding)
+
+BOOST_AUTO_TEST_CASE(SeedfinderParallelGroups) {
+  auto config = makeConfig();
+  auto spacePoints = generateSpacePoints(200, 500, config.bFieldInZ);
+  std::vector<const SpacePoint*> spacePointPtrs;
+  for (const auto& sp : spacePoints) {
+    spacePointPtrs.push_back(&sp);
+  }
+  auto spGroup = makeSpacePointGroup(spacePointPtrs, config);
+  Seedfinder<SpacePoint> finder(config);
+
+  // reference from the serial group iteration
+  SeedsPerGroup reference;
+  for (auto group = spGroup.begin(); !(group == spGroup.end()); ++group) {
+    reference.push_back(finder.createSeedsForGroup(
+        group.bottom(), group.middle(), group.top()));
+  }
+  BOOST_CHECK_EQUAL(spGroup.numGroups(), reference.size());
+
+  // random access in reverse order
+  SeedsPerGroup reversed(spGroup.numGroups());
+  for (size_t igroup = spGroup.numGroups(); 0 < igroup; --igroup) {
+    auto group = spGroup.group(igroup - 1);
+    reversed[igroup - 1] = finder.createSeedsForGroup(
+        group.bottom(), group.middle(), group.top());
+  }
+  checkEqual(reference, reversed);
+
+  checkEqual(reference, finder.createSeedsForGroups(spGroup));
+  checkEqual(reference,
+             finder.createSeedsForGroups(spGroup, SequentialExecutor()));
+  checkEqual(reference,
+             finder.createSeedsForGroups(spGroup, ReverseThreadedExecutor()));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
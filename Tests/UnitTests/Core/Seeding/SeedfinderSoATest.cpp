@@ -0,0 +1,144 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Seeding/BinFinder.hpp"
+#include "Acts/Seeding/BinnedSPGroup.hpp"
+#include "Acts/Seeding/Seed.hpp"
+#include "Acts/Seeding/SeedFilter.hpp"
+#include "Acts/Seeding/Seedfinder.hpp"
+#include "Acts/Seeding/SpacePointGrid.hpp"
+#include "Acts/Seeding/SpacePointSoA.hpp"
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "SeedingTestHelpers.hpp"
+#include "SpacePoint.hpp"
+
+namespace {
+
+using namespace Acts;
+using namespace Acts::Test;
+
+std::vector<std::vector<Seed<SpacePoint>>> runSeeding(
+    const std::vector<const SpacePoint*>& spacePointPtrs,
+    const SeedfinderConfig<SpacePoint>& config) {
+  auto spGroup = makeSpacePointGroup(spacePointPtrs, config);
+
+  Seedfinder<SpacePoint> finder(config);
+  std::vector<std::vector<Seed<SpacePoint>>> seeds;
+  auto groupIt = spGroup.begin();
+  auto endOfGroups = spGroup.end();
+  for (; !(groupIt == endOfGroups); ++groupIt) {
+    seeds.push_back(finder.createSeedsForGroup(
+        groupIt.bottom(), groupIt.middle(), groupIt.top()));
+  }
+  return seeds;
+}
+
+}  // namespace
+
+namespace Acts {
+namespace Test {
+
+BOOST_AUTO_TEST_SUITE(Seeding)
+
+BOOST_AUTO_TEST_CASE(SpacePointSoAFill) {
+  SpacePoint sp{1., 2., 3., std::hypot(1., 2.), 0, 0.1, 0.2};
+  InternalSpacePoint<SpacePoint> isp(sp, {sp.x(), sp.y(), sp.z()}, {0., 0.},
+                                     {sp.varianceR, sp.varianceZ});
+  std::vector<const InternalSpacePoint<SpacePoint>*> range = {&isp, &isp};
+
+  SpacePointSoA<SpacePoint> soa;
+  soa.fill(range);
+  BOOST_CHECK_EQUAL(soa.size(), 2u);
+  BOOST_CHECK_EQUAL(soa.x[1], isp.x());
+  BOOST_CHECK_EQUAL(soa.y[1], isp.y());
+  BOOST_CHECK_EQUAL(soa.z[1], isp.z());
+  BOOST_CHECK_EQUAL(soa.r[1], isp.radius());
+  BOOST_CHECK_EQUAL(soa.varianceR[1], isp.varianceR());
+  BOOST_CHECK_EQUAL(soa.varianceZ[1], isp.varianceZ());
+  BOOST_CHECK_EQUAL(soa.sp[1], &isp);
+
+  SpacePointSoA<SpacePoint> copy;
+  copy.push_back(soa, 0);
+  BOOST_CHECK_EQUAL(copy.size(), 1u);
+  BOOST_CHECK_EQUAL(copy.r[0], isp.radius());
+
+  soa.clear();
+  BOOST_CHECK(soa.empty());
+}
+
+BOOST_AUTO_TEST_CASE(SeedfinderSoABackendMatchesPointerBackend) {
+  auto config = makeConfig();
+  auto spacePoints = generateSpacePoints(200, 500, config.bFieldInZ);
+  std::vector<const SpacePoint*> spacePointPtrs;
+  for (const auto& sp : spacePoints) {
+    spacePointPtrs.push_back(&sp);
+  }
+
+  auto seedsPointer = runSeeding(spacePointPtrs, config);
+  config.useSoABackend = true;
+  auto seedsSoA = runSeeding(spacePointPtrs, config);
+
+  size_t nSeeds = 0;
+  BOOST_REQUIRE_EQUAL(seedsPointer.size(), seedsSoA.size());
+  for (size_t igroup = 0; igroup < seedsPointer.size(); ++igroup) {
+    const auto& groupPointer = seedsPointer[igroup];
+    const auto& groupSoA = seedsSoA[igroup];
+    BOOST_REQUIRE_EQUAL(groupPointer.size(), groupSoA.size());
+    for (size_t iseed = 0; iseed < groupPointer.size(); ++iseed) {
+      BOOST_CHECK(groupPointer[iseed].sp() == groupSoA[iseed].sp());
+      BOOST_CHECK_EQUAL(groupPointer[iseed].z(), groupSoA[iseed].z());
+    }
+    nSeeds += groupPointer.size();
+  }
+  BOOST_CHECK_GT(nSeeds, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(SeedfinderSoABackendRadiusWindow) {
+  auto config = makeConfig();
+  auto spacePoints = generateSpacePoints(200, 500, config.bFieldInZ);
+  std::vector<const SpacePoint*> spacePointPtrs;
+  for (const auto& sp : spacePoints) {
+    spacePointPtrs.push_back(&sp);
+  }
+  auto spGroup = makeSpacePointGroup(spacePointPtrs, config);
+
+  // the content of every bin must be sorted in radius
+  for (auto group = spGroup.begin(); !(group == spGroup.end()); ++group) {
+    SpacePointSoA<SpacePoint> middle;
+    auto middleSPs = group.middle();
+    middle.fill(middleSPs);
+    BOOST_CHECK_LE(middle.sortedRangeEnds.size(), 1u);
+  }
+
+  // the radius window reduces the number of tested doublet candidates
+  size_t numCandidates[2] = {0, 0};
+  for (bool useSoABackend : {false, true}) {
+    config.useSoABackend = useSoABackend;
+    Seedfinder<SpacePoint> finder(config);
+    Seedfinder<SpacePoint>::State state;
+    std::vector<Seed<SpacePoint>> seeds;
+    for (auto group = spGroup.begin(); !(group == spGroup.end()); ++group) {
+      finder.createSeedsForGroup(state, seeds, group.bottom(), group.middle(),
+                                 group.top());
+    }
+    numCandidates[useSoABackend] = state.numDoubletCandidates;
+  }
+  BOOST_CHECK_GT(numCandidates[1], 0u);
+  BOOST_CHECK_LT(numCandidates[1], numCandidates[0]);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
@@ -0,0 +1,91 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/data/test_case.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Seeding/Seed.hpp"
+#include "Acts/Seeding/Seedfinder.hpp"
+
+#include <vector>
+
+#include "SeedingTestHelpers.hpp"
+#include "SpacePoint.hpp"
+
+namespace bdata = boost::unit_test::data;
+
+namespace Acts {
+namespace Test {
+
+BOOST_AUTO_TEST_SUITE(Seeding)
+
+BOOST_DATA_TEST_CASE(SeedfinderStateReuse, bdata::make({false, true}),
+                     useSoABackend) {
+  auto config = makeConfig();
+  config.useSoABackend = useSoABackend;
+  auto spacePoints = generateSpacePoints(200, 500, config.bFieldInZ);
+  std::vector<const SpacePoint*> spacePointPtrs;
+  for (const auto& sp : spacePoints) {
+    spacePointPtrs.push_back(&sp);
+  }
+  auto spGroup = makeSpacePointGroup(spacePointPtrs, config);
+  Seedfinder<SpacePoint> finder(config);
+
+  // reference without an explicit state
+  std::vector<std::vector<Seed<SpacePoint>>> reference;
+  for (auto group = spGroup.begin(); !(group == spGroup.end()); ++group) {
+    reference.push_back(finder.createSeedsForGroup(
+        group.bottom(), group.middle(), group.top()));
+  }
+
+  // run twice with the same state to emulate consecutive events
+  Seedfinder<SpacePoint>::State state;
+  std::vector<Seed<SpacePoint>> seeds;
+  const void* bottomBuffer = nullptr;
+  const void* topBuffer = nullptr;
+  const void* seedsPerSpMBuffer = nullptr;
+  for (int pass = 0; pass < 2; ++pass) {
+    size_t igroup = 0;
+    for (auto group = spGroup.begin(); !(group == spGroup.end()); ++group) {
+      seeds.clear();
+      finder.createSeedsForGroup(state, seeds, group.bottom(), group.middle(),
+                                 group.top());
+      const auto& expected = reference.at(igroup++);
+      BOOST_REQUIRE_EQUAL(seeds.size(), expected.size());
+      for (size_t iseed = 0; iseed < seeds.size(); ++iseed) {
+        BOOST_CHECK(seeds[iseed].sp() == expected[iseed].sp());
+        BOOST_CHECK_EQUAL(seeds[iseed].z(), expected[iseed].z());
+      }
+    }
+    if (pass == 0) {
+      bottomBuffer = useSoABackend ? static_cast<const void*>(
+                                         state.compatBottomSoA.r.data())
+                                   : state.compatBottomSP.data();
+      topBuffer = useSoABackend
+                      ? static_cast<const void*>(state.compatTopSoA.r.data())
+                      : state.compatTopSP.data();
+      seedsPerSpMBuffer = state.seedsPerSpM.data();
+    }
+  }
+  // the scratch buffers are sized by the first pass and not reallocated
+  BOOST_CHECK_NE(bottomBuffer, nullptr);
+  BOOST_CHECK_EQUAL(bottomBuffer,
+                    useSoABackend ? static_cast<const void*>(
+                                        state.compatBottomSoA.r.data())
+                                  : state.compatBottomSP.data());
+  BOOST_CHECK_EQUAL(topBuffer,
+                    useSoABackend
+                        ? static_cast<const void*>(state.compatTopSoA.r.data())
+                        : state.compatTopSP.data());
+  BOOST_CHECK_EQUAL(seedsPerSpMBuffer, state.seedsPerSpM.data());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
@@ -0,0 +1,115 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Seeding/BinFinder.hpp"
+#include "Acts/Seeding/BinnedSPGroup.hpp"
+#include "Acts/Seeding/SeedFilter.hpp"
+#include "Acts/Seeding/SeedfinderConfig.hpp"
+#include "Acts/Seeding/SpacePointGrid.hpp"
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "SpacePoint.hpp"
+
+namespace Acts {
+namespace Test {
+
+/// Generate space points from helical tracks originating close to the
+/// beam line plus some uniformly distributed noise.
+inline std::vector<SpacePoint> generateSpacePoints(size_t nTracks,
+                                                   size_t nNoise,
+                                                   float bFieldInZ) {
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<float> uniformPhi(-M_PI, M_PI);
+  std::uniform_real_distribution<float> uniformEta(-2., 2.);
+  std::uniform_real_distribution<float> uniformZ0(-100., 100.);
+  std::uniform_real_distribution<float> uniformPt(600., 10000.);
+  std::uniform_real_distribution<float> uniformR(30., 155.);
+  std::uniform_real_distribution<float> uniformNoiseZ(-500., 500.);
+  std::normal_distribution<float> smear(0., 0.01);
+  const std::vector<float> layers = {32., 52., 72., 92., 112., 132., 152.};
+
+  std::vector<SpacePoint> spacePoints;
+  for (size_t itrack = 0; itrack < nTracks; ++itrack) {
+    float phi0 = uniformPhi(rng);
+    float cotTheta = std::sinh(uniformEta(rng));
+    float z0 = uniformZ0(rng);
+    float charge = (itrack % 2) ? 1. : -1.;
+    float helixRadius = uniformPt(rng) / (300. * bFieldInZ);
+    for (float r : layers) {
+      float phi = phi0 + charge * std::asin(r / (2 * helixRadius));
+      float x = r * std::cos(phi) + smear(rng);
+      float y = r * std::sin(phi) + smear(rng);
+      float z = z0 + r * cotTheta + smear(rng);
+      spacePoints.push_back(
+          SpacePoint{x, y, z, std::hypot(x, y), 0, 0.0025, 0.0025});
+    }
+  }
+  for (size_t inoise = 0; inoise < nNoise; ++inoise) {
+    float r = uniformR(rng);
+    float phi = uniformPhi(rng);
+    float x = r * std::cos(phi);
+    float y = r * std::sin(phi);
+    spacePoints.push_back(
+        SpacePoint{x, y, uniformNoiseZ(rng), r, 0, 0.0025, 0.0025});
+  }
+  return spacePoints;
+}
+
+inline SeedfinderConfig<SpacePoint> makeConfig() {
+  SeedfinderConfig<SpacePoint> config;
+  config.rMax = 160.;
+  config.deltaRMin = 5.;
+  config.deltaRMax = 160.;
+  config.collisionRegionMin = -250.;
+  config.collisionRegionMax = 250.;
+  config.zMin = -2800.;
+  config.zMax = 2800.;
+  config.maxSeedsPerSpM = 5;
+  config.cotThetaMax = 7.40627;
+  config.sigmaScattering = 1.;
+  config.minPt = 500.;
+  config.bFieldInZ = 0.00199724;
+  config.impactMax = 10.;
+  config.seedFilter = std::make_shared<SeedFilter<SpacePoint>>(
+      SeedFilter<SpacePoint>(SeedFilterConfig()));
+  return config;
+}
+
+/// Bin the given space points into groups using the default bin finders.
+inline BinnedSPGroup<SpacePoint> makeSpacePointGroup(
+    const std::vector<const SpacePoint*>& spacePointPtrs,
+    const SeedfinderConfig<SpacePoint>& config) {
+  SpacePointGridConfig gridConf;
+  gridConf.bFieldInZ = config.bFieldInZ;
+  gridConf.minPt = config.minPt;
+  gridConf.rMax = config.rMax;
+  gridConf.zMax = config.zMax;
+  gridConf.zMin = config.zMin;
+  gridConf.deltaRMax = config.deltaRMax;
+  gridConf.cotThetaMax = config.cotThetaMax;
+
+  auto covariance = [](const SpacePoint& sp, float, float,
+                       float) -> Vector2 {
+    return {sp.varianceR, sp.varianceZ};
+  };
+  auto bottomBinFinder = std::make_shared<BinFinder<SpacePoint>>();
+  auto topBinFinder = std::make_shared<BinFinder<SpacePoint>>();
+  return BinnedSPGroup<SpacePoint>(
+      spacePointPtrs.begin(), spacePointPtrs.end(), covariance,
+      bottomBinFinder, topBinFinder,
+      SpacePointGridCreator::createGrid<SpacePoint>(gridConf), config);
+}
+
+}  // namespace Test
+}  // namespace Acts
@@ -0,0 +1,134 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/PlaneSurfaceBatch.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/TrapezoidBounds.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace Acts {
+namespace Test {
+
+GeometryContext tgContext = GeometryContext();
+
+namespace {
+
+// Rectangular and trapezoidal modules on a barrel-like ring, plus one plane
+// parallel to the test lines
+std::vector<std::shared_ptr<PlaneSurface>> makeSurfaces() {
+  std::vector<std::shared_ptr<PlaneSurface>> surfaces;
+  auto rBounds = std::make_shared<const RectangleBounds>(8., 30.);
+  auto tBounds = std::make_shared<const TrapezoidBounds>(6., 10., 30.);
+  for (int i = 0; i < 16; ++i) {
+    const double phi = 2 * M_PI * i / 16.;
+    Transform3 transform = Transform3::Identity();
+    transform.translation() = Vector3(50 * std::cos(phi), 50 * std::sin(phi),
+                                      (i % 3 - 1) * 20.);
+    transform.rotate(AngleAxis3(phi, Vector3::UnitZ()));
+    transform.rotate(AngleAxis3(0.5 * M_PI, Vector3::UnitY()));
+    transform.rotate(AngleAxis3(0.1, Vector3::UnitZ()));
+    if (i % 2 == 0) {
+      surfaces.push_back(Surface::makeShared<PlaneSurface>(transform, rBounds));
+    } else {
+      surfaces.push_back(Surface::makeShared<PlaneSurface>(transform, tBounds));
+    }
+  }
+  // the plane z = 500 is parallel to all transverse test lines
+  Transform3 parallel = Transform3::Identity();
+  parallel.translation() = Vector3(0., 0., 500.);
+  surfaces.push_back(Surface::makeShared<PlaneSurface>(parallel, rBounds));
+  return surfaces;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(Surfaces)
+
+BOOST_AUTO_TEST_CASE(PlaneSurfaceBatchIntersection) {
+  auto surfaces = makeSurfaces();
+  std::vector<const PlaneSurface*> batchSurfaces;
+  for (const auto& surface : surfaces) {
+    batchSurfaces.push_back(surface.get());
+  }
+  PlaneSurfaceBatch batch(tgContext, batchSurfaces);
+  BOOST_CHECK_EQUAL(batch.size(), surfaces.size());
+
+  // a zero tolerance on a checked axis combined with an unchecked axis is
+  // sensitive to rounding for trapezoids, use a finite one instead
+  const std::vector<BoundaryCheck> bchecks = {
+      BoundaryCheck(false), BoundaryCheck(true),
+      BoundaryCheck(true, true, 2., 5.), BoundaryCheck(true, false, 0.5, 0.),
+      BoundaryCheck(SymMatrix2::Identity(), 3.)};
+
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> phiDist(-M_PI, M_PI);
+  std::uniform_real_distribution<double> zDist(-0.3, 0.3);
+  std::uniform_real_distribution<double> posDist(-5., 5.);
+
+  PlaneSurfaceBatch::Intersections intersections;
+  size_t nValid = 0;
+  size_t nMissed = 0;
+  for (int itest = 0; itest < 200; ++itest) {
+    const double phi = phiDist(rng);
+    const Vector3 position(posDist(rng), posDist(rng), posDist(rng));
+    // transverse lines are parallel to the last plane
+    const Vector3 direction =
+        (itest % 10 == 0) ? Vector3(std::cos(phi), std::sin(phi), 0.)
+                          : Vector3(std::cos(phi), std::sin(phi), zDist(rng))
+                                .normalized();
+    for (const auto& bcheck : bchecks) {
+      batch.intersect(position, direction, bcheck, intersections);
+      BOOST_REQUIRE_EQUAL(intersections.status.size(), surfaces.size());
+      for (size_t i = 0; i < surfaces.size(); ++i) {
+        auto reference =
+            surfaces[i]->intersect(tgContext, position, direction, bcheck);
+        auto batched =
+            batch.surfaceIntersection(intersections, i, position, direction);
+        BOOST_CHECK_EQUAL(batched.object, surfaces[i].get());
+        BOOST_CHECK(batched.intersection.status ==
+                    reference.intersection.status);
+        if (std::isfinite(reference.intersection.pathLength)) {
+          CHECK_CLOSE_REL(batched.intersection.pathLength,
+                          reference.intersection.pathLength, 1e-9);
+          CHECK_SMALL((batched.intersection.position -
+                       reference.intersection.position)
+                          .norm(),
+                      1e-9);
+        } else {
+          BOOST_CHECK(not std::isfinite(batched.intersection.pathLength));
+        }
+        (reference ? nValid : nMissed) += 1;
+      }
+    }
+  }
+  // both outcomes must have been exercised
+  BOOST_CHECK_GT(nValid, 0u);
+  BOOST_CHECK_GT(nMissed, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(PlaneSurfaceBatchEmpty) {
+  PlaneSurfaceBatch batch(tgContext, {});
+  PlaneSurfaceBatch::Intersections intersections;
+  batch.intersect(Vector3::Zero(), Vector3::UnitX(), true, intersections);
+  BOOST_CHECK_EQUAL(batch.size(), 0u);
+  BOOST_CHECK(intersections.status.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
@@ -34,9 +34,11 @@
 #include "Acts/Utilities/Helpers.hpp"
 
 #include <algorithm>
+#include <functional>
 #include <limits>
 #include <memory>
 #include <random>
+#include <thread>
 #include <vector>
 
 namespace {
@@ -220,11 +222,13 @@ BOOST_AUTO_TEST_CASE(ZeroFieldForward) {
     // with the given measurement selection cuts, only one trajectory for the
     // given input parameters should be found.
     BOOST_CHECK_EQUAL(val.trackTips.size(), 1u);
+    // all tracks are stored in the same trajectory
+    BOOST_CHECK_EQUAL(val.fittedStates, results.front().value().fittedStates);
     // check purity of first found track
     // find the number of hits not originating from the right track
     size_t numHits = 0u;
     size_t numMissmatchedHits = 0u;
-    val.fittedStates.visitBackwards(
+    val.fittedStates->visitBackwards(
         val.trackTips.front(), [&](const auto& trackState) {
           numHits += 1u;
           numMissmatchedHits += (trackId != trackState.uncalibrated().sourceId);
@@ -234,6 +238,58 @@ BOOST_AUTO_TEST_CASE(ZeroFieldForward) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(ZeroFieldForwardParallel) {
+  Fixture f(0_T);
+
+  auto options = f.makeCkfOptions();
+  options.propagatorPlainOptions.direction = Acts::forward;
+  auto pSurface = Acts::Surface::makeShared<Acts::PlaneSurface>(
+      Acts::Vector3{-3_m, 0., 0.}, Acts::Vector3{1., 0., 0});
+  options.referenceSurface = &(*pSurface);
+
+  // process each seed on its own thread, joined in reverse order of creation
+  auto executor = [](size_t nSeeds,
+                     const std::function<void(size_t, size_t)>& task) {
+    std::vector<std::thread> threads;
+    for (size_t iseed = nSeeds; 0 < iseed--;) {
+      threads.emplace_back(task, iseed, iseed + 1);
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  };
+
+  auto sequential =
+      f.ckf.findTracks(f.sourceLinks, f.startParameters, options);
+  auto parallel =
+      f.ckf.findTracks(f.sourceLinks, f.startParameters, options, executor);
+  BOOST_REQUIRE_EQUAL(parallel.size(), sequential.size());
+
+  // the results are in seed order and do not depend on the execution
+  for (size_t trackId = 0u; trackId < f.startParameters.size(); ++trackId) {
+    BOOST_REQUIRE(sequential[trackId].ok());
+    BOOST_REQUIRE(parallel[trackId].ok());
+    const auto& seq = *sequential[trackId];
+    const auto& par = *parallel[trackId];
+    BOOST_REQUIRE_EQUAL(par.trackTips.size(), 1u);
+    BOOST_REQUIRE_EQUAL(seq.trackTips.size(), 1u);
+
+    std::vector<size_t> seqSourceIds;
+    std::vector<size_t> parSourceIds;
+    seq.fittedStates->visitBackwards(
+        seq.trackTips.front(), [&](const auto& trackState) {
+          seqSourceIds.push_back(trackState.uncalibrated().sourceId);
+        });
+    par.fittedStates->visitBackwards(
+        par.trackTips.front(), [&](const auto& trackState) {
+          parSourceIds.push_back(trackState.uncalibrated().sourceId);
+          BOOST_CHECK_EQUAL(trackState.uncalibrated().sourceId, trackId);
+        });
+    BOOST_CHECK_EQUAL_COLLECTIONS(seqSourceIds.begin(), seqSourceIds.end(),
+                                  parSourceIds.begin(), parSourceIds.end());
+  }
+}
+
 BOOST_AUTO_TEST_CASE(ZeroFieldBackward) {
   Fixture f(0_T);
 
@@ -269,7 +325,7 @@ BOOST_AUTO_TEST_CASE(ZeroFieldBackward) {
     // find the number of hits not originating from the right track
     size_t numHits = 0u;
     size_t numMissmatchedHits = 0u;
-    val.fittedStates.visitBackwards(
+    val.fittedStates->visitBackwards(
         val.trackTips.front(), [&](const auto& trackState) {
           numHits += 1u;
           numMissmatchedHits += (trackId != trackState.uncalibrated().sourceId);
@@ -0,0 +1,108 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/Measurement.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Tests/CommonHelpers/TestSourceLink.hpp"
+#include "Acts/TrackFinding/MeasurementSelector.hpp"
+
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using namespace Acts;
+using namespace Acts::Test;
+
+using Measurements = std::vector<BoundVariantMeasurement<TestSourceLink>>;
+
+// Predicted parameters at the origin of a plane with a variance of 2 in both
+// local coordinates. Together with a measurement variance of 2, a residual of
+// r results in a chi2 of r^2 / 4 independent of the measurement dimension.
+BoundTrackParameters makePrediction() {
+  auto surface =
+      Surface::makeShared<PlaneSurface>(Vector3::Zero(), Vector3::UnitZ());
+  BoundVector params = BoundVector::Zero();
+  params[eBoundQOverP] = 1.;
+  BoundSymMatrix cov = BoundSymMatrix::Identity();
+  cov(eBoundLoc0, eBoundLoc0) = cov(eBoundLoc1, eBoundLoc1) = 2.;
+  return {surface, params, 1., cov};
+}
+
+auto make1D(double loc0) {
+  return makeMeasurement(TestSourceLink(), ActsVector<1>(loc0),
+                         ActsSymMatrix<1>(2.), eBoundLoc0);
+}
+
+auto make2D(double loc0, double loc1) {
+  return makeMeasurement(TestSourceLink(), Vector2(loc0, loc1),
+                         SymMatrix2(Vector2(2., 2.).asDiagonal()), eBoundLoc0,
+                         eBoundLoc1);
+}
+
+MeasurementSelector makeSelector(double chi2CutOff, size_t numMeasurements) {
+  return MeasurementSelector({{GeometryIdentifier(),
+                               {chi2CutOff, numMeasurements}}});
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TrackFindingMeasurementSelector)
+
+BOOST_AUTO_TEST_CASE(OutlierTieKeepsMeasurementOrder) {
+  const auto prediction = makePrediction();
+  // all measurements fail the cut and have the same chi2 of 0.25. the first
+  // one in the input order is the outlier, regardless of its dimension.
+  const auto selector = makeSelector(0.1, 1u);
+  std::vector<std::pair<size_t, double>> measChi2;
+  std::vector<size_t> candidates;
+  bool isOutlier = false;
+
+  Measurements measurements = {make2D(1., 0.), make1D(1.), make1D(-1.)};
+  BOOST_CHECK(selector(prediction, measurements, measChi2, candidates,
+                       isOutlier, getDummyLogger())
+                  .ok());
+  BOOST_CHECK(isOutlier);
+  BOOST_CHECK_EQUAL(candidates.size(), 1u);
+  BOOST_CHECK_EQUAL(candidates[0], 0u);
+
+  measurements = {make1D(1.), make2D(0., -1.)};
+  BOOST_CHECK(selector(prediction, measurements, measChi2, candidates,
+                       isOutlier, getDummyLogger())
+                  .ok());
+  BOOST_CHECK(isOutlier);
+  BOOST_CHECK_EQUAL(candidates.size(), 1u);
+  BOOST_CHECK_EQUAL(candidates[0], 0u);
+}
+
+BOOST_AUTO_TEST_CASE(CandidatesSortedByChi2) {
+  const auto prediction = makePrediction();
+  const auto selector = makeSelector(2., 2u);
+  std::vector<std::pair<size_t, double>> measChi2;
+  std::vector<size_t> candidates;
+  bool isOutlier = true;
+
+  // chi2 values of 1, 4, 0.25, and 2.25 with mixed dimensions
+  Measurements measurements = {make2D(2., 0.), make1D(4.), make1D(1.),
+                               make2D(0., -3.)};
+  BOOST_CHECK(selector(prediction, measurements, measChi2, candidates,
+                       isOutlier, getDummyLogger())
+                  .ok());
+  BOOST_CHECK(not isOutlier);
+  BOOST_CHECK_EQUAL(candidates.size(), 2u);
+  BOOST_CHECK_EQUAL(candidates[0], 2u);
+  BOOST_CHECK_EQUAL(candidates[1], 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -117,4 +117,37 @@ BOOST_AUTO_TEST_CASE(Smooth) {
   CHECK_CLOSE_ABS(ts3.smoothedCovariance(), expCov, tol);
 }
 
+BOOST_AUTO_TEST_CASE(SmoothSingularPredictedCovariance) {
+  MultiTrajectory<TestSourceLink> traj;
+
+  // The time is not constrained at all, i.e. has vanishing variance
+  CovarianceMatrix covTrk = CovarianceMatrix::Zero();
+  covTrk.diagonal() << 0.08, 0.3, 1, 1, 1, 0;
+  BoundVector parValues;
+  parValues << 0.3, 0.5, 0.5 * M_PI, 0., 1 / 100., 0.;
+
+  size_t ts_idx = SIZE_MAX;
+  for (size_t i = 0; i < 2; ++i) {
+    ts_idx = (i == 0) ? traj.addTrackState(TrackStatePropMask::All)
+                      : traj.addTrackState(TrackStatePropMask::All, ts_idx);
+    auto ts = traj.getTrackState(ts_idx);
+    ts.predicted() = parValues;
+    ts.predictedCovariance() = covTrk;
+    parValues[eBoundLoc0] += 0.01;
+    ts.filtered() = parValues;
+    ts.filteredCovariance() = covTrk;
+    ts.pathLength() = 1. + i;
+    ts.jacobian().setIdentity();
+  }
+
+  BOOST_CHECK(GainMatrixSmoother()(tgContext, traj, ts_idx).ok());
+
+  auto ts = traj.getTrackState(0);
+  BOOST_CHECK(ts.hasSmoothed());
+  BOOST_CHECK(not ts.smoothed().hasNaN());
+  BOOST_CHECK(not ts.smoothedCovariance().hasNaN());
+  // the unconstrained time is not changed by the smoothing
+  CHECK_CLOSE_ABS(ts.smoothed()[eBoundTime], ts.filtered()[eBoundTime], 1e-9);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
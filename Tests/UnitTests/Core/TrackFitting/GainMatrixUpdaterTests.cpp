@@ -18,6 +18,9 @@
 #include "Acts/Tests/CommonHelpers/TestSourceLink.hpp"
 #include "Acts/TrackFitting/GainMatrixUpdater.hpp"
 
+#include <array>
+#include <vector>
+
 namespace {
 
 using namespace Acts;
@@ -83,4 +86,144 @@ BOOST_AUTO_TEST_CASE(Update) {
   CHECK_CLOSE_ABS(ts.chi2(), 1.33958, 1e-4);
 }
 
+BOOST_AUTO_TEST_CASE(UpdateBatch) {
+  // Use more states than fit into a single batch and mix 1d and 2d
+  // measurements such that multiple batches of each dimension are needed.
+  constexpr size_t nStates = 21;
+
+  MultiTrajectory<TestSourceLink> traj;
+  std::vector<MultiTrajectory<TestSourceLink>::TrackStateProxy> states;
+  for (size_t i = 0; i < nStates; ++i) {
+    ParametersVector trkPar;
+    trkPar << 0.3 - 0.01 * i, 0.5, 0.5 * M_PI, 0.3 * M_PI, 0.01, 0.;
+    CovarianceMatrix trkCov = CovarianceMatrix::Zero();
+    trkCov.diagonal() << 0.08, 0.3 + 0.01 * i, 1, 1, 1, 0;
+    // correlate the positions to exercise the off-diagonal terms
+    trkCov(eBoundLoc0, eBoundLoc1) = trkCov(eBoundLoc1, eBoundLoc0) = 0.02;
+
+    auto sourceLink =
+        (i % 3 == 0)
+            ? TestSourceLink(eBoundLoc0, -0.1 + 0.01 * i, 0.04)
+            : TestSourceLink(eBoundLoc0, eBoundLoc1, Vector2(-0.1, 0.45),
+                             Vector2(0.04, 0.1 + 0.01 * i).asDiagonal());
+
+    auto ts = traj.getTrackState(traj.addTrackState(TrackStatePropMask::All));
+    ts.predicted() = trkPar;
+    ts.predictedCovariance() = trkCov;
+    ts.pathLength() = 0.;
+    ts.uncalibrated() = sourceLink;
+    std::visit([&](const auto& m) { ts.setCalibrated(m); },
+               calibrator(sourceLink, nullptr));
+    states.push_back(ts);
+  }
+
+  BOOST_CHECK(GainMatrixUpdater()(tgContext, states).ok());
+
+  // Compare against the textbook gain matrix formalism
+  for (const auto& ts : states) {
+    visit_measurement(
+        ts.calibrated(), ts.calibratedCovariance(), ts.calibratedSize(),
+        [&](const auto calibrated, const auto calibratedCovariance) {
+          constexpr size_t kSize = decltype(calibrated)::RowsAtCompileTime;
+          const ActsMatrix<kSize, eBoundSize> H =
+              ts.projector().template topLeftCorner<kSize, eBoundSize>();
+          const CovarianceMatrix P = ts.predictedCovariance();
+          const ActsSymMatrix<kSize> S =
+              H * P * H.transpose() + calibratedCovariance;
+          const ActsMatrix<eBoundSize, kSize> K =
+              P * H.transpose() * S.inverse();
+          const ActsVector<kSize> residual =
+              calibrated - H * ts.predicted();
+
+          CHECK_CLOSE_ABS(ts.filtered(), ts.predicted() + K * residual, tol);
+          CHECK_CLOSE_ABS(ts.filteredCovariance(),
+                          (CovarianceMatrix::Identity() - K * H) * P, tol);
+          CHECK_CLOSE_ABS(ts.chi2(),
+                          (residual.transpose() * S.inverse() * residual)
+                              .value(),
+                          tol);
+        });
+  }
+}
+
+BOOST_AUTO_TEST_CASE(UpdateJosephForm) {
+  Vector2 measPar(-0.1, 0.45);
+  SymMatrix2 measCov = Vector2(0.04, 0.1).asDiagonal();
+  auto sourceLink = TestSourceLink(eBoundLoc0, eBoundLoc1, measPar, measCov);
+
+  ParametersVector trkPar;
+  trkPar << 0.3, 0.5, 0.5 * M_PI, 0.3 * M_PI, 0.01, 0.;
+  CovarianceMatrix trkCov = CovarianceMatrix::Zero();
+  trkCov.diagonal() << 0.08, 0.3, 1, 1, 1, 0;
+  trkCov(eBoundLoc0, eBoundPhi) = trkCov(eBoundPhi, eBoundLoc0) = 0.1;
+
+  MultiTrajectory<TestSourceLink> traj;
+  std::array<MultiTrajectory<TestSourceLink>::TrackStateProxy, 2> states = {
+      traj.getTrackState(traj.addTrackState(TrackStatePropMask::All)),
+      traj.getTrackState(traj.addTrackState(TrackStatePropMask::All))};
+  for (auto& ts : states) {
+    ts.predicted() = trkPar;
+    ts.predictedCovariance() = trkCov;
+    ts.pathLength() = 0.;
+    ts.uncalibrated() = sourceLink;
+    std::visit([&](const auto& m) { ts.setCalibrated(m); },
+               calibrator(sourceLink, nullptr));
+  }
+
+  BOOST_CHECK(GainMatrixUpdater()(tgContext, states[0]).ok());
+  BOOST_CHECK(JosephFormGainMatrixUpdater()(tgContext, states[1]).ok());
+
+  // Both forms are mathematically equivalent for the optimal gain
+  const ParametersVector expPar = states[0].filtered();
+  const CovarianceMatrix expCov = states[0].filteredCovariance();
+  CHECK_CLOSE_ABS(states[1].filtered(), expPar, tol);
+  CHECK_CLOSE_ABS(states[1].filteredCovariance(), expCov, tol);
+  CHECK_CLOSE_ABS(states[1].chi2(), states[0].chi2(), tol);
+}
+
+BOOST_AUTO_TEST_CASE(UpdateBatchFailure) {
+  // A vanishing residual covariance can not be factorized
+  auto sourceLink = TestSourceLink(eBoundLoc0, 0.1, 0.);
+
+  MultiTrajectory<TestSourceLink> traj;
+  auto ts = traj.getTrackState(traj.addTrackState(TrackStatePropMask::All));
+  ts.predicted() = ParametersVector::Zero();
+  ts.predictedCovariance() = CovarianceMatrix::Zero();
+  ts.pathLength() = 0.;
+  ts.uncalibrated() = sourceLink;
+  std::visit([&](const auto& m) { ts.setCalibrated(m); },
+             calibrator(sourceLink, nullptr));
+
+  auto res = GainMatrixUpdater()(tgContext, ts, backward);
+  BOOST_CHECK(not res.ok());
+  BOOST_CHECK(res.error() == KalmanFitterError::BackwardUpdateFailed);
+
+  // The failure of one state does not affect the others in the same batch
+  auto good = traj.getTrackState(traj.addTrackState(TrackStatePropMask::All));
+  good.predicted() = ParametersVector::Zero();
+  good.predictedCovariance() = CovarianceMatrix::Identity();
+  good.pathLength() = 0.;
+  good.uncalibrated() = sourceLink;
+  std::visit([&](const auto& m) { good.setCalibrated(m); },
+             calibrator(sourceLink, nullptr));
+
+  std::vector<MultiTrajectory<TestSourceLink>::TrackStateProxy> states = {
+      ts, good, ts};
+  std::vector<std::error_code> statuses;
+  GainMatrixUpdater()(tgContext, states, statuses);
+  BOOST_CHECK_EQUAL(statuses.size(), 3u);
+  BOOST_CHECK(statuses[0] == KalmanFitterError::ForwardUpdateFailed);
+  BOOST_CHECK(not statuses[1]);
+  BOOST_CHECK(statuses[2] == KalmanFitterError::ForwardUpdateFailed);
+  CHECK_CLOSE_ABS(good.filtered()[eBoundLoc0], 0.1, tol);
+  CHECK_CLOSE_ABS(good.chi2(), 0.01, tol);
+
+  // Without statuses, the error of the first failing state is returned,
+  // but all other states are still updated
+  good.filtered() = ParametersVector::Zero();
+  res = GainMatrixUpdater()(tgContext, states);
+  BOOST_CHECK(res.error() == KalmanFitterError::ForwardUpdateFailed);
+  CHECK_CLOSE_ABS(good.filtered()[eBoundLoc0], 0.1, tol);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
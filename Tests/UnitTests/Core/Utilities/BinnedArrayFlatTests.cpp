@@ -0,0 +1,123 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Utilities/BinUtility.hpp"
+#include "Acts/Utilities/BinnedArrayFlat.hpp"
+#include "Acts/Utilities/BinnedArrayXD.hpp"
+
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace Acts {
+namespace Test {
+
+namespace {
+
+using Object = const int*;
+using ObjectsAndPositions = std::vector<std::pair<Object, Vector3>>;
+
+// binning in x, y and z with a different number of bins per axis
+std::unique_ptr<const BinUtility> makeBinUtility(size_t dim) {
+  auto bu = std::make_unique<BinUtility>(5, -5., 5., open, binX);
+  if (dim > 1) {
+    *bu += BinUtility(3, -3., 3., open, binY);
+  }
+  if (dim > 2) {
+    std::vector<float> zBoundaries = {-4., -1., 0., 2., 4.};
+    *bu += BinUtility(zBoundaries, open, binZ);
+  }
+  return bu;
+}
+
+// one object at a random position in every bin
+ObjectsAndPositions makeObjects(const BinUtility& bu,
+                                std::vector<int>& storage) {
+  const size_t nBins = bu.bins();
+  storage.resize(nBins);
+  ObjectsAndPositions tapVector;
+  std::mt19937 rng(11);
+  std::uniform_real_distribution<double> dist(-5., 5.);
+  size_t nFilled = 0;
+  while (nFilled < nBins) {
+    const Vector3 position(dist(rng), dist(rng), dist(rng));
+    if (not bu.inside(position)) {
+      continue;
+    }
+    const auto bins = bu.binTriple(position);
+    const size_t index =
+        bins[0] + bu.bins(0) * (bins[1] + bu.bins(1) * bins[2]);
+    if (storage[index] == 0) {
+      storage[index] = 1;
+      tapVector.emplace_back(&storage[index], position);
+      ++nFilled;
+    }
+  }
+  return tapVector;
+}
+
+template <size_t DIM>
+void compareToBinnedArrayXD() {
+  std::vector<int> storage;
+  auto bu = makeBinUtility(DIM);
+  const auto tapVector = makeObjects(*bu, storage);
+
+  BinnedArrayXD<Object> reference(tapVector, makeBinUtility(DIM));
+  BinnedArrayFlat<Object, DIM> flat(tapVector, makeBinUtility(DIM));
+  BinnedArrayFlat<Object, DIM> fromGrid(reference.objectGrid(),
+                                        makeBinUtility(DIM));
+
+  BOOST_CHECK(flat.arrayObjects() == reference.arrayObjects());
+  BOOST_CHECK(flat.objectGrid() == reference.objectGrid());
+  BOOST_CHECK(fromGrid.objectGrid() == reference.objectGrid());
+  BOOST_CHECK_EQUAL(flat.arrayObjects().size(), bu->bins());
+
+  // including positions outside of the binning
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> dist(-6., 6.);
+  for (size_t i = 0; i < 1000; ++i) {
+    const Vector3 position(dist(rng), dist(rng), dist(rng));
+    std::array<size_t, 3> bins, referenceBins;
+    BOOST_CHECK_EQUAL(flat.object(position, bins),
+                      reference.object(position, referenceBins));
+    BOOST_CHECK(bins == referenceBins);
+    BOOST_CHECK_EQUAL(fromGrid.object(position), reference.object(position));
+    const Vector2 lposition(position.x(), position.y());
+    BOOST_CHECK_EQUAL(flat.object(lposition, bins),
+                      reference.object(lposition, referenceBins));
+    BOOST_CHECK(bins == referenceBins);
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(Utilities)
+
+BOOST_AUTO_TEST_CASE(BinnedArrayFlatLookup) {
+  compareToBinnedArrayXD<1>();
+  compareToBinnedArrayXD<2>();
+  compareToBinnedArrayXD<3>();
+}
+
+BOOST_AUTO_TEST_CASE(BinnedArrayFlatDimensionMismatch) {
+  ObjectsAndPositions tapVector;
+  BOOST_CHECK_THROW(
+      (BinnedArrayFlat<Object, 2>(tapVector, makeBinUtility(1))),
+      std::invalid_argument);
+  BOOST_CHECK_THROW((BinnedArrayFlat<Object, 1>(tapVector, nullptr)),
+                    std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
@@ -1267,6 +1267,34 @@ BOOST_AUTO_TEST_CASE(closestPoints) {
   // clang-format on
 }
 
+BOOST_AUTO_TEST_CASE(grid_exterior_bins) {
+  using EAxis = EquidistantAxis;
+  using Grid3_t = Grid<double, EAxis, EAxis, EAxis>;
+  const auto axes =
+      std::make_tuple(EAxis(0., 3., 3u), EAxis(0., 1., 1u), EAxis(0., 4., 4u));
+  Grid3_t g(axes);
+  for (size_t bin = 0; bin < g.size(); ++bin) {
+    g.at(bin) = 1.;
+  }
+  g.setExteriorBins(0.);
+
+  // every bin with an under- or overflow index on any axis is exterior
+  const auto nBins = g.numLocalBins();
+  size_t nExterior = 0;
+  for (size_t bin = 0; bin < g.size(); ++bin) {
+    const auto local = g.localBinsFromGlobalBin(bin);
+    bool exterior = false;
+    for (size_t d = 0; d < 3; ++d) {
+      exterior = exterior or local[d] == 0 or local[d] == nBins[d] + 1;
+    }
+    nExterior += exterior ? 1 : 0;
+    BOOST_CHECK_EQUAL(g.at(bin), exterior ? 0. : 1.);
+  }
+  BOOST_CHECK_EQUAL(nExterior, g.size() - 3 * 1 * 4);
+  BOOST_CHECK_EQUAL(grid_helper::exteriorBinIndices(axes).size(),
+                    nExterior);
+}
+
 }  // namespace Test
 
 }  // namespace Acts